@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/byte_queue/tests.cpp" "tests/CMakeFiles/tests.dir/byte_queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/byte_queue/tests.cpp.o.d"
+  "/root/repo/tests/deque/tests.cpp" "tests/CMakeFiles/tests.dir/deque/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/deque/tests.cpp.o.d"
+  "/root/repo/tests/dynamic_queue/tests.cpp" "tests/CMakeFiles/tests.dir/dynamic_queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/dynamic_queue/tests.cpp.o.d"
+  "/root/repo/tests/mpmc_queue/tests.cpp" "tests/CMakeFiles/tests.dir/mpmc_queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/mpmc_queue/tests.cpp.o.d"
+  "/root/repo/tests/multicast_queue/tests.cpp" "tests/CMakeFiles/tests.dir/multicast_queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/multicast_queue/tests.cpp.o.d"
+  "/root/repo/tests/pool/tests.cpp" "tests/CMakeFiles/tests.dir/pool/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/pool/tests.cpp.o.d"
+  "/root/repo/tests/queue/tests.cpp" "tests/CMakeFiles/tests.dir/queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/queue/tests.cpp.o.d"
+  "/root/repo/tests/select/tests.cpp" "tests/CMakeFiles/tests.dir/select/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/select/tests.cpp.o.d"
+  "/root/repo/tests/shm_queue/tests.cpp" "tests/CMakeFiles/tests.dir/shm_queue/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/shm_queue/tests.cpp.o.d"
+  "/root/repo/tests/tests.cpp" "tests/CMakeFiles/tests.dir/tests.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
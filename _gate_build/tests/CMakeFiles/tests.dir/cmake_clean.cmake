@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/byte_queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/byte_queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/deque/tests.cpp.o"
+  "CMakeFiles/tests.dir/deque/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/dynamic_queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/dynamic_queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/mpmc_queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/mpmc_queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/multicast_queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/multicast_queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/pool/tests.cpp.o"
+  "CMakeFiles/tests.dir/pool/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/select/tests.cpp.o"
+  "CMakeFiles/tests.dir/select/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/shm_queue/tests.cpp.o"
+  "CMakeFiles/tests.dir/shm_queue/tests.cpp.o.d"
+  "CMakeFiles/tests.dir/tests.cpp.o"
+  "CMakeFiles/tests.dir/tests.cpp.o.d"
+  "tests"
+  "tests.pdb"
+  "tests_tests-b858cb2.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
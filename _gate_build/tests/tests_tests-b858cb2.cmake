@@ -0,0 +1,161 @@
+add_test( [==[Can be default constructed]==] /root/repo/_gate_build/tests/tests [==[Can be default constructed]==])
+set_tests_properties( [==[Can be default constructed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can select the conservative memory model]==] /root/repo/_gate_build/tests/tests [==[Can select the conservative memory model]==])
+set_tests_properties( [==[Can select the conservative memory model]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can construct from initializer list]==] /root/repo/_gate_build/tests/tests [==[Can construct from initializer list]==])
+set_tests_properties( [==[Can construct from initializer list]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can push and pop elements]==] /root/repo/_gate_build/tests/tests [==[Can push and pop elements]==])
+set_tests_properties( [==[Can push and pop elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Popped elements are the same as pushed]==] /root/repo/_gate_build/tests/tests [==[Popped elements are the same as pushed]==])
+set_tests_properties( [==[Popped elements are the same as pushed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue correctly reports when it is empty and full]==] /root/repo/_gate_build/tests/tests [==[Queue correctly reports when it is empty and full]==])
+set_tests_properties( [==[Queue correctly reports when it is empty and full]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue reports the correct number of enqueued elements]==] /root/repo/_gate_build/tests/tests [==[Queue reports the correct number of enqueued elements]==])
+set_tests_properties( [==[Queue reports the correct number of enqueued elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue can be cleared]==] /root/repo/_gate_build/tests/tests [==[Queue can be cleared]==])
+set_tests_properties( [==[Queue can be cleared]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue can be instantiated from an initializer list]==] /root/repo/_gate_build/tests/tests [==[Queue can be instantiated from an initializer list]==])
+set_tests_properties( [==[Queue can be instantiated from an initializer list]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue handles type conversions]==] /root/repo/_gate_build/tests/tests [==[Queue handles type conversions]==])
+set_tests_properties( [==[Queue handles type conversions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue accepts non-default-constructible types]==] /root/repo/_gate_build/tests/tests [==[Queue accepts non-default-constructible types]==])
+set_tests_properties( [==[Queue accepts non-default-constructible types]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue accepts move-only types]==] /root/repo/_gate_build/tests/tests [==[Queue accepts move-only types]==])
+set_tests_properties( [==[Queue accepts move-only types]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue accepts a range of elements]==] /root/repo/_gate_build/tests/tests [==[Queue accepts a range of elements]==])
+set_tests_properties( [==[Queue accepts a range of elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Elements can be emplaced in the slot]==] /root/repo/_gate_build/tests/tests [==[Elements can be emplaced in the slot]==])
+set_tests_properties( [==[Elements can be emplaced in the slot]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Producer can reserve and commit a slot in place]==] /root/repo/_gate_build/tests/tests [==[Producer can reserve and commit a slot in place]==])
+set_tests_properties( [==[Producer can reserve and commit a slot in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Consumer can observe and consume the front element in place]==] /root/repo/_gate_build/tests/tests [==[Consumer can observe and consume the front element in place]==])
+set_tests_properties( [==[Consumer can observe and consume the front element in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Power-of-two capacities use the mask-based index scheme]==] /root/repo/_gate_build/tests/tests [==[Power-of-two capacities use the mask-based index scheme]==])
+set_tests_properties( [==[Power-of-two capacities use the mask-based index scheme]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Batch operations handle a wrapping free region]==] /root/repo/_gate_build/tests/tests [==[Batch operations handle a wrapping free region]==])
+set_tests_properties( [==[Batch operations handle a wrapping free region]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[The core header provides the waiting-free queue]==] /root/repo/_gate_build/tests/tests [==[The core header provides the waiting-free queue]==])
+set_tests_properties( [==[The core header provides the waiting-free queue]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Latency instrumentation records enqueue-to-dequeue percentiles]==] /root/repo/_gate_build/tests/tests [==[Latency instrumentation records enqueue-to-dequeue percentiles]==])
+set_tests_properties( [==[Latency instrumentation records enqueue-to-dequeue percentiles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Counter instrumentation tracks outcomes and the high-water mark]==] /root/repo/_gate_build/tests/tests [==[Counter instrumentation tracks outcomes and the high-water mark]==])
+set_tests_properties( [==[Counter instrumentation tracks outcomes and the high-water mark]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Overwrite policy keeps the newest elements]==] /root/repo/_gate_build/tests/tests [==[Overwrite policy keeps the newest elements]==])
+set_tests_properties( [==[Overwrite policy keeps the newest elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue can be drained with a single index update]==] /root/repo/_gate_build/tests/tests [==[Queue can be drained with a single index update]==])
+set_tests_properties( [==[Queue can be drained with a single index update]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queue can be partially drained in buffer order]==] /root/repo/_gate_build/tests/tests [==[Queue can be partially drained in buffer order]==])
+set_tests_properties( [==[Queue can be partially drained in buffer order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Elements can be consumed with a functor]==] /root/repo/_gate_build/tests/tests [==[Elements can be consumed with a functor]==])
+set_tests_properties( [==[Elements can be consumed with a functor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Slot lifetimes track occupancy]==] /root/repo/_gate_build/tests/tests [==[Slot lifetimes track occupancy]==])
+set_tests_properties( [==[Slot lifetimes track occupancy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Queued elements can be observed without popping]==] /root/repo/_gate_build/tests/tests [==[Queued elements can be observed without popping]==])
+set_tests_properties( [==[Queued elements can be observed without popping]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Observation walks the readable region across the buffer wrap]==] /root/repo/_gate_build/tests/tests [==[Observation walks the readable region across the buffer wrap]==])
+set_tests_properties( [==[Observation walks the readable region across the buffer wrap]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Readable region can be processed in place]==] /root/repo/_gate_build/tests/tests [==[Readable region can be processed in place]==])
+set_tests_properties( [==[Readable region can be processed in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can be used safely in a multithreaded context]==] /root/repo/_gate_build/tests/tests [==[Can be used safely in a multithreaded context]==])
+set_tests_properties( [==[Can be used safely in a multithreaded context]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can be used safely with multiple producers (mpsc)]==] /root/repo/_gate_build/tests/tests [==[Can be used safely with multiple producers (mpsc)]==])
+set_tests_properties( [==[Can be used safely with multiple producers (mpsc)]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can be used safely with multiple consumers (spmc)]==] /root/repo/_gate_build/tests/tests [==[Can be used safely with multiple consumers (spmc)]==])
+set_tests_properties( [==[Can be used safely with multiple consumers (spmc)]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Wait operations accept a backoff policy]==] /root/repo/_gate_build/tests/tests [==[Wait operations accept a backoff policy]==])
+set_tests_properties( [==[Wait operations accept a backoff policy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Blocking waits park and wake across threads]==] /root/repo/_gate_build/tests/tests [==[Blocking waits park and wake across threads]==])
+set_tests_properties( [==[Blocking waits park and wake across threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Blocking pops are woken by multi-producer pushes]==] /root/repo/_gate_build/tests/tests [==[Blocking pops are woken by multi-producer pushes]==])
+set_tests_properties( [==[Blocking pops are woken by multi-producer pushes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can time out on *_wait_for operations]==] /root/repo/_gate_build/tests/tests [==[Can time out on *_wait_for operations]==])
+set_tests_properties( [==[Can time out on *_wait_for operations]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[co_pop completes immediately when an element is ready]==] /root/repo/_gate_build/tests/tests [==[co_pop completes immediately when an element is ready]==])
+set_tests_properties( [==[co_pop completes immediately when an element is ready]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[co_pop suspends on an empty queue and push resumes it]==] /root/repo/_gate_build/tests/tests [==[co_pop suspends on an empty queue and push resumes it]==])
+set_tests_properties( [==[co_pop suspends on an empty queue and push resumes it]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[co_push suspends on a full queue and pop resumes it]==] /root/repo/_gate_build/tests/tests [==[co_push suspends on a full queue and pop resumes it]==])
+set_tests_properties( [==[co_push suspends on a full queue and pop resumes it]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[co_pop is resumed by a multi-producer push]==] /root/repo/_gate_build/tests/tests [==[co_pop is resumed by a multi-producer push]==])
+set_tests_properties( [==[co_pop is resumed by a multi-producer push]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Awaitables bridge a producer thread with no polling]==] /root/repo/_gate_build/tests/tests [==[Awaitables bridge a producer thread with no polling]==])
+set_tests_properties( [==[Awaitables bridge a producer thread with no polling]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[MPMC queue can be default constructed]==] /root/repo/_gate_build/tests/tests [==[MPMC queue can be default constructed]==])
+set_tests_properties( [==[MPMC queue can be default constructed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[MPMC queue can push and pop elements]==] /root/repo/_gate_build/tests/tests [==[MPMC queue can push and pop elements]==])
+set_tests_properties( [==[MPMC queue can push and pop elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[MPMC queue pops the same elements as pushed]==] /root/repo/_gate_build/tests/tests [==[MPMC queue pops the same elements as pushed]==])
+set_tests_properties( [==[MPMC queue pops the same elements as pushed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[MPMC queue accepts a range of elements]==] /root/repo/_gate_build/tests/tests [==[MPMC queue accepts a range of elements]==])
+set_tests_properties( [==[MPMC queue accepts a range of elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Can be used safely with multiple producers and consumers]==] /root/repo/_gate_build/tests/tests [==[Can be used safely with multiple producers and consumers]==])
+set_tests_properties( [==[Can be used safely with multiple producers and consumers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue rounds its capacity up to a power of two]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue rounds its capacity up to a power of two]==])
+set_tests_properties( [==[Dynamic queue rounds its capacity up to a power of two]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue can push and pop elements]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue can push and pop elements]==])
+set_tests_properties( [==[Dynamic queue can push and pop elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue rejects pushes when full]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue rejects pushes when full]==])
+set_tests_properties( [==[Dynamic queue rejects pushes when full]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue supports batch operations]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue supports batch operations]==])
+set_tests_properties( [==[Dynamic queue supports batch operations]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue accepts huge-page backing requests]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue accepts huge-page backing requests]==])
+set_tests_properties( [==[Dynamic queue accepts huge-page backing requests]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue places its ring through a user allocator]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue places its ring through a user allocator]==])
+set_tests_properties( [==[Dynamic queue places its ring through a user allocator]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Dynamic queue can be used safely in a multithreaded context]==] /root/repo/_gate_build/tests/tests [==[Dynamic queue can be used safely in a multithreaded context]==])
+set_tests_properties( [==[Dynamic queue can be used safely in a multithreaded context]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Pool vends every element and reports exhaustion]==] /root/repo/_gate_build/tests/tests [==[Pool vends every element and reports exhaustion]==])
+set_tests_properties( [==[Pool vends every element and reports exhaustion]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Pool elements have stable addresses across reuse]==] /root/repo/_gate_build/tests/tests [==[Pool elements have stable addresses across reuse]==])
+set_tests_properties( [==[Pool elements have stable addresses across reuse]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Pool handles release automatically]==] /root/repo/_gate_build/tests/tests [==[Pool handles release automatically]==])
+set_tests_properties( [==[Pool handles release automatically]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Pool provides an allocation-free return path]==] /root/repo/_gate_build/tests/tests [==[Pool provides an allocation-free return path]==])
+set_tests_properties( [==[Pool provides an allocation-free return path]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Shared-memory queue can be created in and attached to a region]==] /root/repo/_gate_build/tests/tests [==[Shared-memory queue can be created in and attached to a region]==])
+set_tests_properties( [==[Shared-memory queue can be created in and attached to a region]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Shared-memory queue crosses a process boundary]==] /root/repo/_gate_build/tests/tests [==[Shared-memory queue crosses a process boundary]==])
+set_tests_properties( [==[Shared-memory queue crosses a process boundary]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Byte queue serves contiguous variable-length reservations]==] /root/repo/_gate_build/tests/tests [==[Byte queue serves contiguous variable-length reservations]==])
+set_tests_properties( [==[Byte queue serves contiguous variable-length reservations]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Byte queue rejects reservations that cannot be contiguous]==] /root/repo/_gate_build/tests/tests [==[Byte queue rejects reservations that cannot be contiguous]==])
+set_tests_properties( [==[Byte queue rejects reservations that cannot be contiguous]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Byte queue wraps a reservation past the watermark]==] /root/repo/_gate_build/tests/tests [==[Byte queue wraps a reservation past the watermark]==])
+set_tests_properties( [==[Byte queue wraps a reservation past the watermark]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Byte queue commits may be shorter than their reservation]==] /root/repo/_gate_build/tests/tests [==[Byte queue commits may be shorter than their reservation]==])
+set_tests_properties( [==[Byte queue commits may be shorter than their reservation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Byte queue can be used safely in a multithreaded context]==] /root/repo/_gate_build/tests/tests [==[Byte queue can be used safely in a multithreaded context]==])
+set_tests_properties( [==[Byte queue can be used safely in a multithreaded context]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Select reports no queue ready when all are empty]==] /root/repo/_gate_build/tests/tests [==[Select reports no queue ready when all are empty]==])
+set_tests_properties( [==[Select reports no queue ready when all are empty]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Select finds the one non-empty queue]==] /root/repo/_gate_build/tests/tests [==[Select finds the one non-empty queue]==])
+set_tests_properties( [==[Select finds the one non-empty queue]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Select services ready queues in rotation]==] /root/repo/_gate_build/tests/tests [==[Select services ready queues in rotation]==])
+set_tests_properties( [==[Select services ready queues in rotation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Select drops queues from the bitmap as they drain]==] /root/repo/_gate_build/tests/tests [==[Select drops queues from the bitmap as they drain]==])
+set_tests_properties( [==[Select drops queues from the bitmap as they drain]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Select can fan in from producer threads]==] /root/repo/_gate_build/tests/tests [==[Select can fan in from producer threads]==])
+set_tests_properties( [==[Select can fan in from producer threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Multicast queue delivers every element to every consumer]==] /root/repo/_gate_build/tests/tests [==[Multicast queue delivers every element to every consumer]==])
+set_tests_properties( [==[Multicast queue delivers every element to every consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Multicast producer gates on the slowest consumer]==] /root/repo/_gate_build/tests/tests [==[Multicast producer gates on the slowest consumer]==])
+set_tests_properties( [==[Multicast producer gates on the slowest consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Multicast consumers registered late start at the head]==] /root/repo/_gate_build/tests/tests [==[Multicast consumers registered late start at the head]==])
+set_tests_properties( [==[Multicast consumers registered late start at the head]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Multicast overwrite policy laps slow consumers]==] /root/repo/_gate_build/tests/tests [==[Multicast overwrite policy laps slow consumers]==])
+set_tests_properties( [==[Multicast overwrite policy laps slow consumers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Multicast queue can be used safely in a multithreaded context]==] /root/repo/_gate_build/tests/tests [==[Multicast queue can be used safely in a multithreaded context]==])
+set_tests_properties( [==[Multicast queue can be used safely in a multithreaded context]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque survives popping and stealing while virgin]==] /root/repo/_gate_build/tests/tests [==[Deque survives popping and stealing while virgin]==])
+set_tests_properties( [==[Deque survives popping and stealing while virgin]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque pops in LIFO order on the owner's end]==] /root/repo/_gate_build/tests/tests [==[Deque pops in LIFO order on the owner's end]==])
+set_tests_properties( [==[Deque pops in LIFO order on the owner's end]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque steals in FIFO order from the thieves' end]==] /root/repo/_gate_build/tests/tests [==[Deque steals in FIFO order from the thieves' end]==])
+set_tests_properties( [==[Deque steals in FIFO order from the thieves' end]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque push fails when full]==] /root/repo/_gate_build/tests/tests [==[Deque push fails when full]==])
+set_tests_properties( [==[Deque push fails when full]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque hands the last element to exactly one end]==] /root/repo/_gate_build/tests/tests [==[Deque hands the last element to exactly one end]==])
+set_tests_properties( [==[Deque hands the last element to exactly one end]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+add_test( [==[Deque can be used safely in a multithreaded context]==] /root/repo/_gate_build/tests/tests [==[Deque can be used safely in a multithreaded context]==])
+set_tests_properties( [==[Deque can be used safely in a multithreaded context]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build/tests)
+set( tests_TESTS [==[Can be default constructed]==] [==[Can select the conservative memory model]==] [==[Can construct from initializer list]==] [==[Can push and pop elements]==] [==[Popped elements are the same as pushed]==] [==[Queue correctly reports when it is empty and full]==] [==[Queue reports the correct number of enqueued elements]==] [==[Queue can be cleared]==] [==[Queue can be instantiated from an initializer list]==] [==[Queue handles type conversions]==] [==[Queue accepts non-default-constructible types]==] [==[Queue accepts move-only types]==] [==[Queue accepts a range of elements]==] [==[Elements can be emplaced in the slot]==] [==[Producer can reserve and commit a slot in place]==] [==[Consumer can observe and consume the front element in place]==] [==[Power-of-two capacities use the mask-based index scheme]==] [==[Batch operations handle a wrapping free region]==] [==[The core header provides the waiting-free queue]==] [==[Latency instrumentation records enqueue-to-dequeue percentiles]==] [==[Counter instrumentation tracks outcomes and the high-water mark]==] [==[Overwrite policy keeps the newest elements]==] [==[Queue can be drained with a single index update]==] [==[Queue can be partially drained in buffer order]==] [==[Elements can be consumed with a functor]==] [==[Slot lifetimes track occupancy]==] [==[Queued elements can be observed without popping]==] [==[Observation walks the readable region across the buffer wrap]==] [==[Readable region can be processed in place]==] [==[Can be used safely in a multithreaded context]==] [==[Can be used safely with multiple producers (mpsc)]==] [==[Can be used safely with multiple consumers (spmc)]==] [==[Wait operations accept a backoff policy]==] [==[Blocking waits park and wake across threads]==] [==[Blocking pops are woken by multi-producer pushes]==] [==[Can time out on *_wait_for operations]==] [==[co_pop completes immediately when an element is ready]==] [==[co_pop suspends on an empty queue and push resumes it]==] [==[co_push suspends on a full queue and pop resumes it]==] [==[co_pop is resumed by a multi-producer push]==] [==[Awaitables bridge a producer thread with no polling]==] [==[MPMC queue can be default constructed]==] [==[MPMC queue can push and pop elements]==] [==[MPMC queue pops the same elements as pushed]==] [==[MPMC queue accepts a range of elements]==] [==[Can be used safely with multiple producers and consumers]==] [==[Dynamic queue rounds its capacity up to a power of two]==] [==[Dynamic queue can push and pop elements]==] [==[Dynamic queue rejects pushes when full]==] [==[Dynamic queue supports batch operations]==] [==[Dynamic queue accepts huge-page backing requests]==] [==[Dynamic queue places its ring through a user allocator]==] [==[Dynamic queue can be used safely in a multithreaded context]==] [==[Pool vends every element and reports exhaustion]==] [==[Pool elements have stable addresses across reuse]==] [==[Pool handles release automatically]==] [==[Pool provides an allocation-free return path]==] [==[Shared-memory queue can be created in and attached to a region]==] [==[Shared-memory queue crosses a process boundary]==] [==[Byte queue serves contiguous variable-length reservations]==] [==[Byte queue rejects reservations that cannot be contiguous]==] [==[Byte queue wraps a reservation past the watermark]==] [==[Byte queue commits may be shorter than their reservation]==] [==[Byte queue can be used safely in a multithreaded context]==] [==[Select reports no queue ready when all are empty]==] [==[Select finds the one non-empty queue]==] [==[Select services ready queues in rotation]==] [==[Select drops queues from the bitmap as they drain]==] [==[Select can fan in from producer threads]==] [==[Multicast queue delivers every element to every consumer]==] [==[Multicast producer gates on the slowest consumer]==] [==[Multicast consumers registered late start at the head]==] [==[Multicast overwrite policy laps slow consumers]==] [==[Multicast queue can be used safely in a multithreaded context]==] [==[Deque survives popping and stealing while virgin]==] [==[Deque pops in LIFO order on the owner's end]==] [==[Deque steals in FIFO order from the thieves' end]==] [==[Deque push fails when full]==] [==[Deque hands the last element to exactly one end]==] [==[Deque can be used safely in a multithreaded context]==])
@@ -0,0 +1,12 @@
+#
+# Google Benchmark
+#
+# The performance suite is optional: when the benchmark package is not installed the
+# benchmarks target is simply skipped.
+#
+
+find_package(benchmark QUIET)
+
+if(NOT benchmark_FOUND)
+  message(STATUS "Google Benchmark not found — skipping the benchmarks target")
+endif()
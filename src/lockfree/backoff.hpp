@@ -0,0 +1,84 @@
+/****************************************************************************************\
+  @file      backoff.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_BACKOFF_HPP
+#define LOCKFREE_BACKOFF_HPP
+
+#include <thread>
+
+/****************************************************************************************\
+
+  Backoff policies for the `_wait` and `_wait_for` families of queue methods. A policy
+  is a callable invoked once per failed attempt; the choice is a compile-time knob (a
+  method template parameter), so latency-critical users — e.g. audio threads — can
+  keep pure spinning while contended server deployments back off politely.
+
+\****************************************************************************************/
+
+namespace lockfree::backoff {
+
+/** Emits the architecture's spin-loop hint instruction, if it has one
+ *
+ * The hint de-prioritizes the spinning hardware thread (helping an SMT sibling doing
+ * real work) and reduces the memory-order-violation flush cost when the awaited line
+ * finally changes.
+ */
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("isb" ::: "memory");
+#elif defined(__arm__)
+  asm volatile("yield" ::: "memory");
+#else
+  /* no spin hint available on this architecture */
+#endif
+}
+
+/** Pure spinning — no backoff at all (the pre-existing `_wait` behaviour) */
+struct spin
+{
+  void operator()() noexcept { }
+};
+
+/** One spin-loop hint per failed attempt */
+struct pause
+{
+  void operator()() noexcept { cpu_relax(); }
+};
+
+/** Exponential backoff: 1, 2, 4, ... spin hints per attempt, then timeslice yields
+ *
+ * Doubles the number of spin hints after each failed attempt up to a cap, after which
+ * it yields the timeslice — keeping short waits cheap while preventing a long wait
+ * from saturating a core and hammering the shared index line.
+ */
+class exponential
+{
+public:
+  void operator()() noexcept
+  {
+    if (count_ <= max_pauses_)
+    {
+      for (auto i = 0; i < count_; ++i) { cpu_relax(); }
+      count_ *= 2;
+    }
+    else
+    { std::this_thread::yield(); }
+  }
+
+private:
+  static constexpr auto max_pauses_ = 64;
+  int count_ { 1 };
+};
+
+} // namespace lockfree::backoff
+
+#endif // LOCKFREE_BACKOFF_HPP
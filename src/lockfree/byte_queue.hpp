@@ -0,0 +1,31 @@
+/****************************************************************************************\
+  @file      byte_queue.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_BYTE_QUEUE_HPP
+#define LOCKFREE_BYTE_QUEUE_HPP
+
+#include "byte_queue_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::byte_queue
+ * @extends lockfree::detail::byte_queue
+ */
+template<std::size_t queue_size,
+         enum memory_model model = memory_model::acquire_release>
+class byte_queue : public detail::byte_queue<queue_size, model>
+{
+  using super = detail::byte_queue<queue_size, model>;
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_BYTE_QUEUE_HPP
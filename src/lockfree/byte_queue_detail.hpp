@@ -0,0 +1,252 @@
+/****************************************************************************************\
+  @file      byte_queue_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_BYTE_QUEUE_DETAIL_HPP
+#define LOCKFREE_BYTE_QUEUE_DETAIL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <span>
+
+#include "queue_core.hpp"
+
+/****************************************************************************************\
+
+  An SPSC bip-buffer ("bipartite buffer") over a byte ring, for variable-length
+  messages framed directly in ring memory. Unlike the slotted queue, a reservation is
+  always contiguous: when a request does not fit in the tail of the ring but does fit
+  at the front, the producer wraps early and records the byte where valid data ends
+  (the watermark) for the consumer to follow. The consumer in turn always sees a
+  contiguous readable block, so messages can be serialized into — and parsed out of —
+  the ring with no intermediate copy and no per-message allocation.
+
+  The index discipline is the same as `queue__base`: each side owns its index and
+  loads the opposite one with acquire only when a cached copy no longer suffices;
+  publication is a single release store. Offsets run over [0, queue_size] rather than
+  monotonically, because a wrap is an explicit event here rather than arithmetic.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<std::size_t queue_size,
+         memory_model model = memory_model::acquire_release>
+class byte_queue
+{
+public:
+
+  static_assert(queue_size >= 2, "a bip-buffer needs at least two bytes of ring");
+
+  byte_queue() noexcept = default;
+
+  // The ring hands out pointers into itself, so it must not move or be duplicated
+  byte_queue(byte_queue const&) = delete;
+  byte_queue & operator=(byte_queue const&) = delete;
+
+/****************************************************************************************\
+  Producer interface
+\****************************************************************************************/
+
+  /** Reserves `length` contiguous bytes for writing
+   *
+   * The bytes remain invisible to the consumer until `commit`. When the tail of the
+   * ring is too short the reservation wraps to the front, provided enough released
+   * space is available there — so the returned region is always contiguous.
+   *
+   * @param[in] length The number of bytes required
+   * @returns A pointer to the writable region, or `nullptr` if the ring cannot
+   *   currently supply `length` contiguous bytes
+   * @note Producer-thread only; at most one reservation may be outstanding.
+   */
+  std::byte * reserve(std::size_t length) noexcept
+  {
+    auto const write = write_.load(order_relaxed_);
+
+    // Try against the cached read offset first; it only ever trails the true one,
+    // so refreshing can only widen the apparent free space.
+    if (auto region = free_region(length, write, read_cache_))
+    { return region; }
+
+    read_cache_ = read_.load(order_acquire_);
+    return free_region(length, write, read_cache_);
+  }
+
+  /** Publishes the first `length` bytes of the current reservation
+   *
+   * @pre A successful `reserve(n)` with `length <= n` and no intervening commit.
+   * @param[in] length The number of bytes actually written (may be less than reserved)
+   * @note Producer-thread only.
+   */
+  void commit(std::size_t length) noexcept
+  {
+    if (pending_wrap_)
+    {
+      // The watermark must be visible before the wrapped write offset is: its plain
+      // store is sequenced before the release store that the consumer acquires.
+      watermark_.store(write_.load(order_relaxed_), std::memory_order_relaxed);
+      write_.store(length, order_release_);
+    }
+    else
+    {
+      write_.store(pending_offset_ + length, order_release_);
+    }
+  }
+
+/****************************************************************************************\
+  Consumer interface
+\****************************************************************************************/
+
+  /** Returns the contiguous block of readable bytes at the front of the ring
+   *
+   * An empty span means the ring is empty. The block ends either at the producer's
+   * write offset or at the watermark where the producer wrapped; in the latter case
+   * the bytes after the watermark were never written and are skipped transparently.
+   *
+   * @returns A span over readable ring memory, valid until the next `release`
+   * @note Consumer-thread only.
+   */
+  std::span<std::byte const> peek() noexcept
+  {
+    auto read = read_.load(order_relaxed_);
+
+    auto region = readable_region(read, write_cache_);
+    if (region.empty())
+    {
+      write_cache_ = write_.load(order_acquire_);
+      region = readable_region(read, write_cache_);
+    }
+
+    return region;
+  }
+
+  /** Releases the first `length` bytes of the readable block back to the producer
+   *
+   * @pre `length <= peek().size()`.
+   * @param[in] length The number of bytes consumed
+   * @note Consumer-thread only.
+   */
+  void release(std::size_t length) noexcept
+  {
+    read_.store(read_.load(order_relaxed_) + length, order_release_);
+  }
+
+/****************************************************************************************\
+  Observers
+\****************************************************************************************/
+
+  /** The ring's capacity in bytes; a single message can be at most this long */
+  static constexpr std::size_t capacity() noexcept { return queue_size; }
+
+  /** The number of unread bytes
+   *
+   * @note As with `queue::size()`, only an instantaneous approximation while either
+   *   side is active.
+   */
+  std::size_t size() const noexcept
+  {
+    auto const read  = read_.load();
+    auto const write = write_.load();
+
+    if (write >= read) { return write - read; }
+    return (watermark_.load(std::memory_order_relaxed) - read) + write;
+  }
+
+  /** Whether the ring holds no unread bytes */
+  bool empty() const noexcept { return size() == 0; }
+
+private:
+
+  /** The contiguous free region for a reservation, or `nullptr` if there is none
+   *
+   * Also records where the reservation begins (and whether it wrapped) for `commit`.
+   */
+  std::byte * free_region(std::size_t length, std::size_t write, std::size_t read) noexcept
+  {
+    if (write >= read)
+    {
+      // Free space is the tail [write, queue_size), then the front [0, read). A
+      // wrapped reservation must leave one byte before `read` so that a full ring
+      // never masquerades as an empty one.
+      if (queue_size - write >= length)
+      {
+        pending_offset_ = write;
+        pending_wrap_   = false;
+        return data_ + write;
+      }
+
+      if (read > length)
+      {
+        pending_offset_ = 0;
+        pending_wrap_   = true;
+        return data_;
+      }
+
+      return nullptr;
+    }
+
+    // Already wrapped: free space is [write, read), again minus the one-byte gap
+    if (read - write > length)
+    {
+      pending_offset_ = write;
+      pending_wrap_   = false;
+      return data_ + write;
+    }
+
+    return nullptr;
+  }
+
+  /** The contiguous readable region implied by a read/write offset pair
+   *
+   * Skips over the watermark (resetting the read offset to the front) when the
+   * producer wrapped and everything before the wrap has been released.
+   */
+  std::span<std::byte const> readable_region(std::size_t & read, std::size_t write) noexcept
+  {
+    if (write >= read)
+    { return { data_ + read, write - read }; }
+
+    auto const watermark = watermark_.load(std::memory_order_relaxed);
+    if (read == watermark)
+    {
+      // Everything before the wrap is consumed; hop to the front. The release
+      // ordering frees the tail [watermark, queue_size) to the producer.
+      read = 0;
+      read_.store(0, order_release_);
+      return { data_, write };
+    }
+
+    return { data_ + read, watermark - read };
+  }
+
+  // The orderings collapse to `seq_cst` under the conservative memory model.
+  static constexpr auto order_relaxed_ = model == memory_model::acquire_release
+    ? std::memory_order_relaxed : std::memory_order_seq_cst;
+  static constexpr auto order_acquire_ = model == memory_model::acquire_release
+    ? std::memory_order_acquire : std::memory_order_seq_cst;
+  static constexpr auto order_release_ = model == memory_model::acquire_release
+    ? std::memory_order_release : std::memory_order_seq_cst;
+
+  // Same cache-line discipline as `queue__base`: each side's offset and its cached
+  // copy of the other side's offset share a line owned by that side. The watermark
+  // is producer-written and shares the producer's line; the consumer reads it only
+  // around a wrap, which is exactly when it must touch the producer's state anyway.
+  alignas(cache_line_size) std::atomic<std::size_t> read_   { 0 };
+  std::size_t write_cache_ { 0 };                // consumer-owned
+  alignas(cache_line_size) std::atomic<std::size_t> write_  { 0 };
+  std::size_t read_cache_ { 0 };                 // producer-owned
+  std::atomic<std::size_t> watermark_ { 0 };
+  std::size_t pending_offset_ { 0 };             // producer-owned
+  bool pending_wrap_ { false };                  // producer-owned
+
+  alignas(cache_line_size) std::byte data_[queue_size];
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_BYTE_QUEUE_DETAIL_HPP
@@ -0,0 +1,34 @@
+/****************************************************************************************\
+  @file      deque.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_DEQUE_HPP
+#define LOCKFREE_DEQUE_HPP
+
+#include "deque_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::deque
+ * @extends lockfree::detail::deque
+ */
+template<typename data_type,
+         std::size_t deque_size,
+         enum memory_model model = memory_model::acquire_release>
+class deque : public detail::deque<data_type, deque_size, model>
+{
+  using super = detail::deque<data_type, deque_size, model>;
+
+public:
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_DEQUE_HPP
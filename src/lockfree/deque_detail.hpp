@@ -0,0 +1,220 @@
+/****************************************************************************************\
+  @file      deque_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_DEQUE_DETAIL_HPP
+#define LOCKFREE_DEQUE_DETAIL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "queue_core.hpp"
+
+/****************************************************************************************\
+
+  A bounded work-stealing deque after Chase and Lev. The owner thread pushes and pops
+  at the bottom without any read-modify-write on the fast path; any number of thief
+  threads steal from the top, each steal costing a single CAS. The two ends only
+  contend over the last remaining element, which is resolved by CAS on `top_`.
+
+  Unlike the dynamic original, the buffer is static and a push into a full deque
+  simply fails — in a scheduler the owner then runs the task inline instead of
+  queueing it, which is the usual overflow strategy anyway. Indices are monotonic,
+  so the capacity must be a power of two.
+
+  A thief copies a slot before claiming it with the CAS, so a thief that loses the
+  race may have copied a slot the owner was already reusing; the copy is discarded,
+  but it must at least be harmless, which is why the element type has to be trivially
+  copyable. Work items are typically pointers or small PODs, so this costs nothing
+  in practice.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, std::size_t deque_size,
+         memory_model model = memory_model::acquire_release>
+class deque
+{
+public:
+
+  static_assert((deque_size & (deque_size - 1)) == 0,
+                "deque indices are monotonic, so the capacity must be a power of two");
+  static_assert(std::is_trivially_copyable_v<data_type>,
+                "thieves copy a slot before claiming it, so the element type must be "
+                "trivially copyable");
+
+  using type = data_type;
+
+  deque() noexcept = default;
+
+  // Copying would duplicate the ends out from under the owner and the thieves
+  deque(deque const&) = delete;
+  deque & operator=(deque const&) = delete;
+
+  /** The number of elements the deque holds */
+  static constexpr std::size_t capacity() noexcept
+  { return deque_size; }
+
+  /** True when the deque appears empty (exact only on the owner thread) */
+  bool empty() const noexcept
+  { return size() == 0; }
+
+  /** The apparent number of queued elements (exact only on the owner thread) */
+  std::size_t size() const noexcept
+  {
+    auto const bottom = bottom_.load(order_relaxed_);
+    auto const top    = top_.load(order_relaxed_);
+    return bottom > top ? bottom - top : 0;
+  }
+
+  /** Pushes an element at the bottom — owner thread only
+   *
+   * Wait-free: no read-modify-write and no retry loop. A full deque fails the push;
+   * the owner is expected to run the work inline instead.
+   *
+   * @returns `true` if the element was enqueued, `false` if the deque was full
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_cvref_t<U>, data_type>);
+
+    auto const bottom = bottom_.load(order_relaxed_);
+    auto const top    = top_.load(order_acquire_);
+
+    if (bottom - top == deque_size) { return false; }
+
+    buffer_[slot(bottom)] = std::forward<U>(elem);
+    bottom_.store(bottom + 1, order_release_);
+    return true;
+  }
+
+  /** Pops the most recently pushed element — owner thread only
+   *
+   * LIFO on the owner's end keeps the hot task (and its cache footprint) local.
+   * Only when a single element remains can a thief contend, and the tie is broken
+   * by the same CAS on `top_` that steals use.
+   *
+   * @returns `true` if an element was dequeued into `elem`, `false` if empty
+   */
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    // Bail out before reserving anything: decrementing an empty deque's `bottom_`
+    // below `top_` would wrap the unsigned index and corrupt both ends. `top_` never
+    // exceeds `bottom_`, and a stale (too-small) load only sends us into the
+    // reservation path below, which re-examines `top_` under the fence.
+    if (bottom_.load(order_relaxed_) == top_.load(order_relaxed_))
+    { return false; }
+
+    auto const bottom = bottom_.load(order_relaxed_) - 1;
+    bottom_.store(bottom, order_relaxed_);
+
+    // The decrement must be visible to thieves before `top_` is examined, or a
+    // thief and the owner could both claim the last element.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto top = top_.load(order_relaxed_);
+
+    if (top > bottom) // already empty: undo the reservation
+    {
+      bottom_.store(bottom + 1, order_relaxed_);
+      return false;
+    }
+
+    elem = buffer_[slot(bottom)];
+
+    if (top == bottom) // last element: race any thieves for it
+    {
+      auto const won = top_.compare_exchange_strong(top, top + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+      bottom_.store(bottom + 1, order_relaxed_);
+      return won;
+    }
+
+    return true;
+  }
+
+  /** @overload returning the element in a `std::optional` */
+  std::optional<data_type> pop() noexcept
+  {
+    auto elem = data_type { };
+    if (pop(elem)) { return elem; }
+    return std::nullopt;
+  }
+
+  /** Steals the oldest element — callable from any thief thread
+   *
+   * FIFO on the thieves' end steals the task the owner is least likely to touch
+   * soon, which tends to hand over a whole subtree of work. A failed CAS means
+   * another thread claimed the element first; the copy made beforehand is
+   * discarded.
+   *
+   * @returns `true` if an element was stolen into `elem`, `false` if the deque was
+   *   empty or the race was lost
+   */
+  template<typename U>
+  bool steal(U & elem) noexcept
+  {
+    auto top = top_.load(order_acquire_);
+
+    // Pair with the fence in `pop`: the owner's reservation of `bottom` must be
+    // ordered against this thief's view of it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto const bottom = bottom_.load(order_acquire_);
+
+    if (top >= bottom) { return false; }
+
+    // Copy before the CAS — after it, the owner may reuse the slot.
+    elem = buffer_[slot(top)];
+
+    return top_.compare_exchange_strong(top, top + 1,
+                                        std::memory_order_seq_cst,
+                                        std::memory_order_relaxed);
+  }
+
+  /** @overload returning the element in a `std::optional` */
+  std::optional<data_type> steal() noexcept
+  {
+    auto elem = data_type { };
+    if (steal(elem)) { return elem; }
+    return std::nullopt;
+  }
+
+private:
+
+  static constexpr std::size_t slot(std::size_t index) noexcept
+  { return index & (deque_size - 1); }
+
+  // The orderings collapse to `seq_cst` under the conservative memory model.
+  static constexpr auto order_relaxed_ = model == memory_model::acquire_release
+    ? std::memory_order_relaxed : std::memory_order_seq_cst;
+  static constexpr auto order_acquire_ = model == memory_model::acquire_release
+    ? std::memory_order_acquire : std::memory_order_seq_cst;
+  static constexpr auto order_release_ = model == memory_model::acquire_release
+    ? std::memory_order_release : std::memory_order_seq_cst;
+
+  // The owner's end and the thieves' end live on separate cache lines, as does the
+  // buffer; unlike the SPSC queue there is no cached opposite index, because `top_`
+  // moves under CAS contention and a stale cache would make `push` fail spuriously.
+  alignas(cache_line_size) std::atomic<std::size_t> bottom_ { 0 };
+  alignas(cache_line_size) std::atomic<std::size_t> top_    { 0 };
+
+  alignas(cache_line_size) std::array<data_type, deque_size> buffer_ { };
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_DEQUE_DETAIL_HPP
@@ -0,0 +1,31 @@
+/****************************************************************************************\
+  @file      dynamic_queue.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_DYNAMIC_QUEUE_HPP
+#define LOCKFREE_DYNAMIC_QUEUE_HPP
+
+#include "dynamic_queue_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::dynamic_queue
+ * @extends lockfree::detail::dynamic_queue
+ */
+template<typename data_type, enum memory_model model = memory_model::acquire_release,
+         typename allocator_type = std::allocator<std::byte>>
+class dynamic_queue : public detail::dynamic_queue<data_type, model, allocator_type>
+{
+  using super = detail::dynamic_queue<data_type, model, allocator_type>;
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_DYNAMIC_QUEUE_HPP
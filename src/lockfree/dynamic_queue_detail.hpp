@@ -0,0 +1,453 @@
+/****************************************************************************************\
+  @file      dynamic_queue_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_DYNAMIC_QUEUE_DETAIL_HPP
+#define LOCKFREE_DYNAMIC_QUEUE_DETAIL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "queue.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+#endif
+
+/****************************************************************************************\
+
+  The heap-backed sibling of `queue__base`. Where the compile-time queue relies
+  entirely on in-object storage, practical capacities there are limited by stack (and
+  object) size; this variant takes its capacity as a constructor argument and backs
+  the ring with a single aligned heap — or mmap'd — allocation, optionally requesting
+  huge-page backing to reduce TLB pressure on very large rings. The index discipline
+  (monotonic counters, cached opposite index, acquire/release publication) matches the
+  power-of-two scheme of `queue__base`.
+
+  The ring's placement can be controlled with the allocator parameter — the lever for
+  NUMA-aware placement on multi-socket machines, where a ring remote to both sides
+  costs on every slot access. Pass an allocator that binds to the desired node, or
+  rely on first-touch: the raw-storage discipline means no slot is touched before it
+  is pushed into, so with a first-touch kernel policy, pages land on the producer's
+  node naturally — or deterministically, by calling `prefault()` from a thread pinned
+  there before use.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, memory_model model = memory_model::acquire_release,
+         typename allocator_type = std::allocator<std::byte>>
+struct dynamic_queue__base
+{
+public:
+  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
+                std::is_nothrow_move_constructible_v<data_type>);
+  static_assert(std::is_nothrow_destructible_v<data_type>);
+
+  using type = data_type;
+
+  /** The ring is carved from cache-line-sized chunks so that any allocator — which
+   *  need only honour `alignof(storage_chunk_t)` — yields a 64-byte-aligned buffer.
+   */
+  struct alignas(cache_line_size) storage_chunk_t
+  { std::byte bytes_[cache_line_size]; };
+
+  using chunk_allocator_t =
+    typename std::allocator_traits<allocator_type>::template rebind_alloc<storage_chunk_t>;
+
+  /** Constructs a queue able to hold at least `min_capacity` elements
+   *
+   * The capacity is rounded up to the next power of two so that indices can wrap with
+   * a bitwise AND; `capacity()` reports the actual value.
+   *
+   * @param[in] min_capacity The minimum number of elements the queue must hold
+   * @param[in] backing The page backing requested for the ring allocation
+   * @throws std::bad_alloc when the backing allocation fails
+   */
+  explicit dynamic_queue__base(std::size_t min_capacity,
+                               page_backing backing = page_backing::normal)
+  : capacity_ { round_up_pow2(std::max<std::size_t>(min_capacity, 2)) }
+  , backing_  { backing }
+  , storage_  { allocate(capacity_ * sizeof(data_type), backing) }
+  {
+  }
+
+  /** Constructs a queue whose ring is placed by the given allocator
+   *
+   * The allocator decides where the ring lives — the hook for NUMA-aware placement:
+   * bind the allocation to the producer's node, or combine a plain allocator with
+   * `prefault()` for first-touch placement. Page backing is the allocator's business
+   * on this path.
+   *
+   * @param[in] min_capacity The minimum number of elements the queue must hold
+   * @param[in] allocator The allocator providing the ring's backing storage
+   * @throws Whatever the allocator throws when the allocation fails
+   */
+  dynamic_queue__base(std::size_t min_capacity, allocator_type const& allocator)
+  : capacity_      { round_up_pow2(std::max<std::size_t>(min_capacity, 2)) }
+  , backing_       { page_backing::normal }
+  , allocator_     { allocator }
+  , use_allocator_ { true }
+  , storage_       { allocator_.allocate(chunk_count(capacity_)) }
+  {
+  }
+
+  dynamic_queue__base(dynamic_queue__base const&) = delete;
+  dynamic_queue__base & operator=(dynamic_queue__base const&) = delete;
+
+  ~dynamic_queue__base() noexcept
+  {
+    auto read_index  = read_index_.load();
+    auto write_index = write_index_.load();
+
+    while (read_index != write_index)
+    {
+      destroy(read_index);
+      ++read_index;
+    }
+
+    if (use_allocator_)
+    {
+      allocator_.deallocate(static_cast<storage_chunk_t *>(storage_),
+                            chunk_count(capacity_));
+    }
+    else
+    { deallocate(storage_, capacity_ * sizeof(data_type), backing_); }
+  }
+
+  /** Pre-faults the ring's pages from the calling thread
+   *
+   * Under a first-touch policy (the Linux default), a page is placed on the NUMA
+   * node of the thread that first writes it. Raw slot storage is never touched
+   * before an element is pushed, so calling this from a thread pinned to the target
+   * node deterministically binds the whole ring there before production starts.
+   *
+   * @pre The queue is not yet in use (the ring holds no live elements).
+   */
+  void prefault() noexcept
+  {
+    constexpr auto page_size = std::size_t { 4096 };
+    auto * bytes = static_cast<std::byte volatile *>(storage_);
+
+    for (auto offset = std::size_t { 0 };
+         offset < capacity_ * sizeof(data_type); offset += page_size)
+    { bytes[offset] = std::byte { 0 }; }
+  }
+
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_reference_t<U>, data_type>);
+
+    auto old_write_index = write_index_.load(order_relaxed_);
+
+    if (old_write_index - read_index_cache_ == capacity_)
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      if (old_write_index - read_index_cache_ == capacity_)
+      { return false; } // the queue is full
+    }
+
+    construct(old_write_index, std::forward<U>(elem));
+    write_index_.store(old_write_index + 1, order_release_);
+    return true;
+  }
+
+  template<typename... Args>
+  bool emplace(Args &&... args) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<data_type, Args...>);
+
+    auto old_write_index = write_index_.load(order_relaxed_);
+
+    if (old_write_index - read_index_cache_ == capacity_)
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      if (old_write_index - read_index_cache_ == capacity_)
+      { return false; }
+    }
+
+    construct(old_write_index, std::forward<Args>(args)...);
+    write_index_.store(old_write_index + 1, order_release_);
+    return true;
+  }
+
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    static_assert(std::is_convertible_v<data_type, U>);
+
+    auto old_read_index = read_index_.load(order_relaxed_);
+
+    if (old_read_index == write_index_cache_)
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      if (old_read_index == write_index_cache_)
+      { return false; } // queue is empty
+    }
+
+    elem = std::move(*slot_ptr(old_read_index));
+    destroy(old_read_index);
+    read_index_.store(old_read_index + 1, order_release_);
+    return true;
+  }
+
+  template<typename Iterator>
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<data_type, decltype(*first)>);
+
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const old_write_index = write_index_.load(order_relaxed_);
+
+    auto free_slots = capacity_ - (old_write_index - read_index_cache_);
+    if (free_slots < requested)
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      free_slots = capacity_ - (old_write_index - read_index_cache_);
+    }
+
+    auto const count = std::min(requested, free_slots);
+
+    for (auto i = std::size_t { 0 }; i < count; ++i)
+    { construct(old_write_index + i, *first++); }
+
+    write_index_.store(old_write_index + count, order_release_);
+    return count;
+  }
+
+  template<typename Iterator>
+  std::size_t pop_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_assignable_v<decltype(*first), data_type>);
+
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const old_read_index = read_index_.load(order_relaxed_);
+
+    auto available = write_index_cache_ - old_read_index;
+    if (available < requested)
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      available = write_index_cache_ - old_read_index;
+    }
+
+    auto const count = std::min(requested, available);
+
+    for (auto i = std::size_t { 0 }; i < count; ++i)
+    {
+      *first++ = std::move(*slot_ptr(old_read_index + i));
+      destroy(old_read_index + i);
+    }
+
+    read_index_.store(old_read_index + count, order_release_);
+    return count;
+  }
+
+protected:
+  static constexpr auto round_up_pow2(std::size_t n) noexcept -> std::size_t
+  {
+    auto result = std::size_t { 1 };
+    while (result < n) { result <<= 1; }
+    return result;
+  }
+
+  /** The number of cache-line chunks backing a ring of `capacity` elements */
+  static constexpr auto chunk_count(std::size_t capacity) noexcept -> std::size_t
+  { return (capacity * sizeof(data_type) + sizeof(storage_chunk_t) - 1) / sizeof(storage_chunk_t); }
+
+  void * slot_address(std::size_t index) noexcept
+  { return static_cast<std::byte *>(storage_) + (index & (capacity_ - 1)) * sizeof(data_type); }
+
+  data_type * slot_ptr(std::size_t index) noexcept
+  { return std::launder(reinterpret_cast<data_type *>(slot_address(index))); }
+
+  template<typename... Args>
+  data_type * construct(std::size_t index, Args &&... args) noexcept
+  { return ::new (slot_address(index)) data_type ( std::forward<Args>(args)... ); }
+
+  void destroy(std::size_t index) noexcept
+  { slot_ptr(index)->~data_type(); }
+
+  /** Allocates the ring's backing storage
+   *
+   * Huge-page requests are satisfied with mmap where available: `huge` attempts an
+   * explicit 2MB-page (MAP_HUGETLB) mapping and degrades to a transparent-huge-page
+   * hint when the system has no huge pages reserved; `transparent_huge` maps normally
+   * and advises the kernel with MADV_HUGEPAGE. On platforms without these facilities
+   * both fall back to a plain aligned allocation.
+   */
+  static void * allocate(std::size_t bytes, page_backing backing)
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    if (backing != page_backing::normal)
+    {
+  #if defined(MAP_HUGETLB)
+      if (backing == page_backing::huge)
+      {
+        auto * mem = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mem != MAP_FAILED)
+        { return mem; }
+        // No explicit huge pages available; fall through to the transparent hint
+      }
+  #endif
+      auto * mem = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (mem == MAP_FAILED)
+      { throw std::bad_alloc { }; }
+  #if defined(MADV_HUGEPAGE)
+      ::madvise(mem, bytes, MADV_HUGEPAGE); // advisory only; failure is benign
+  #endif
+      return mem;
+    }
+#endif
+    return ::operator new (bytes, std::align_val_t { cache_line_size });
+  }
+
+  static void deallocate(void * mem, std::size_t bytes, page_backing backing) noexcept
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    if (backing != page_backing::normal)
+    {
+      ::munmap(mem, bytes);
+      return;
+    }
+#endif
+    ::operator delete (mem, bytes, std::align_val_t { cache_line_size });
+  }
+
+  static constexpr auto order_relaxed_ = model == memory_model::acquire_release
+    ? std::memory_order_relaxed : std::memory_order_seq_cst;
+  static constexpr auto order_acquire_ = model == memory_model::acquire_release
+    ? std::memory_order_acquire : std::memory_order_seq_cst;
+  static constexpr auto order_release_ = model == memory_model::acquire_release
+    ? std::memory_order_release : std::memory_order_seq_cst;
+
+  // Same line discipline as queue__base: each index on its own line, alongside the
+  // thread-owned cache of the opposite index.
+  alignas(cache_line_size) std::atomic<std::size_t> read_index_  { 0 };
+  std::size_t write_index_cache_ { 0 }; // consumer-owned
+  alignas(cache_line_size) std::atomic<std::size_t> write_index_ { 0 };
+  std::size_t read_index_cache_ { 0 };  // producer-owned
+
+  alignas(cache_line_size) std::size_t capacity_;
+  page_backing backing_;
+
+  // Cold state: consulted only at construction and destruction. The allocator is
+  // carried (rebound to chunks) even on the page-backing path, where it stays unused.
+  [[no_unique_address]] chunk_allocator_t allocator_ { };
+  bool use_allocator_ { false };
+
+  void * storage_;
+};
+
+/** A lockfree SPSC queue with runtime capacity and heap (or mmap) backing
+ *
+ * The heap-backed sibling of `lockfree::queue`: the same SPSC semantics and API, but
+ * the capacity is a constructor argument, so rings of millions of elements are
+ * practical without blowing thread stacks. Large rings can additionally request
+ * huge-page backing (see `lockfree::page_backing`) to reduce TLB misses.
+ *
+ * The capacity is rounded up to a power of two; `capacity()` reports the actual value.
+ *
+ * @tparam data_type The queue's internal storage type
+ * @tparam memory_model The index memory-ordering policy, as for `lockfree::queue`
+ * @tparam allocator_type The allocator placing the ring when the allocator-taking
+ *   constructor is used — the hook for NUMA-aware placement (see `prefault()`)
+ */
+template<typename data_type, memory_model model = memory_model::acquire_release,
+         typename allocator_type = std::allocator<std::byte>>
+class dynamic_queue : public dynamic_queue__base<data_type, model, allocator_type>
+{
+  using base = dynamic_queue__base<data_type, model, allocator_type>;
+
+public:
+  using base::base; // inherit constructors
+
+  /** Returns the number of elements the queue can hold */
+  std::size_t capacity() const noexcept
+  { return this->capacity_; }
+
+  /** Checks whether the queue is empty
+   *  @note not thread-safe
+   */
+  bool empty() const noexcept
+  { return this->read_index_.load() == this->write_index_.load(); }
+
+  /** Checks whether the queue is full
+   *  @note not thread-safe
+   */
+  bool full() const noexcept
+  { return size() == this->capacity_; }
+
+  /** Returns the number of enqueued elements
+   *  @note This operation is not thread-safe.
+   */
+  std::size_t size() const noexcept
+  { return this->write_index_.load() - this->read_index_.load(); }
+
+  /** Discards (and destroys) the enqueued elements.
+   *  @post The queue is empty.
+   *  @note May only be called from the consumer thread.
+   */
+  void clear() noexcept
+  {
+    auto read_index  = this->read_index_.load();
+    auto write_index = this->write_index_.load();
+
+    while (read_index != write_index)
+    {
+      this->destroy(read_index);
+      ++read_index;
+    }
+
+    this->read_index_.store(read_index);
+  }
+
+  /** Pushes an element to the queue, retrying until successful */
+  template<typename backoff_policy = backoff::spin, typename U>
+  void push_wait(U && elem) noexcept
+  {
+    auto backoff = backoff_policy { };
+    while (! base::push(std::forward<U>(elem)) )
+    { backoff(); }
+  }
+
+  /** Pops an element from the queue, retrying until successful */
+  template<typename backoff_policy = backoff::spin, typename U>
+  void pop_wait(U & elem) noexcept
+  {
+    auto backoff = backoff_policy { };
+    while (! base::pop(elem) )
+    { backoff(); }
+  }
+
+  /** Convenience wrapper for dynamic_queue::pop(data_type&)
+   *
+   *  @returns optional containing element if pop was successfull, std::nullopt otherwise
+   */
+  std::optional<data_type> pop() noexcept
+  {
+    auto elem = data_type (/* default construct data_type */);
+    return base::pop(elem) ? std::optional<data_type> { std::move(elem) } : std::nullopt;
+  }
+
+  using base::pop;
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_DYNAMIC_QUEUE_DETAIL_HPP
@@ -0,0 +1,154 @@
+/****************************************************************************************\
+  @file      instrument.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_INSTRUMENT_HPP
+#define LOCKFREE_INSTRUMENT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/****************************************************************************************\
+
+  Latency instrumentation for the `instrumentation::latency_histogram` queue policy.
+  The histogram is HDR-style: values are bucketed by their leading power of two with
+  sixteen linear sub-buckets per power, bounding the relative error of any recorded
+  value (and hence any reported percentile) to 1/16 regardless of magnitude. Recording
+  is a single relaxed fetch_add, so the consumer's hot path stays lock-free and a
+  monitoring thread may snapshot concurrently.
+
+\****************************************************************************************/
+
+namespace lockfree {
+
+/** The counter snapshot returned by `stats()` under `instrumentation::counters`
+ *
+ * All counters are maintained with relaxed atomics owned by the side that writes
+ * them, so a snapshot taken while the queue is in motion is approximate — each field
+ * individually is exact, but they need not describe the same instant.
+ */
+struct queue_statistics
+{
+  std::uint64_t pushed          { 0 }; ///< elements successfully pushed
+  std::uint64_t push_failures   { 0 }; ///< pushes (or batch elements) rejected because the queue was full
+  std::uint64_t pop_failures    { 0 }; ///< pops (or batch elements) rejected because the queue was empty
+  std::size_t   high_water_mark { 0 }; ///< highest occupancy observed by the producer
+};
+
+/** The percentile summary returned by `latency_histogram::snapshot` */
+struct latency_snapshot
+{
+  std::chrono::nanoseconds p50  { 0 }; ///< median enqueue-to-dequeue latency
+  std::chrono::nanoseconds p99  { 0 };
+  std::chrono::nanoseconds p999 { 0 };
+  std::chrono::nanoseconds max  { 0 };
+  std::uint64_t count { 0 };           ///< number of recorded samples
+};
+
+/** A lock-free log-linear (HDR-style) histogram of nanosecond latencies */
+class latency_histogram
+{
+public:
+
+  /** Records one sample; wait-free, callable from the consumer's hot path */
+  void record(std::chrono::nanoseconds latency) noexcept
+  {
+    // A non-monotonic clock adjustment can only happen with a misused clock, but a
+    // negative sample would index garbage — clamp instead.
+    auto const value = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+
+    counts_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+
+    auto prev = max_.load(std::memory_order_relaxed);
+    while (value > prev
+           && ! max_.compare_exchange_weak(prev, value, std::memory_order_relaxed))
+    { }
+
+    count_.fetch_add(1, std::memory_order_release);
+  }
+
+  /** Computes p50/p99/p999/max from the current bucket counts
+   *
+   * Concurrent `record` calls may or may not be included; the result is a consistent
+   * lower bound either way. Percentiles are reported as the lower bound of their
+   * bucket, so they are conservative by at most 1/16 of their magnitude.
+   */
+  latency_snapshot snapshot() const noexcept
+  {
+    auto result = latency_snapshot { };
+    result.count = count_.load(std::memory_order_acquire);
+    result.max   = std::chrono::nanoseconds { static_cast<std::int64_t>(
+                     max_.load(std::memory_order_relaxed)) };
+
+    auto counts = std::array<std::uint64_t, bucket_count_> { };
+    auto total  = std::uint64_t { 0 };
+    for (auto i = std::size_t { 0 }; i < bucket_count_; ++i)
+    { total += counts[i] = counts_[i].load(std::memory_order_relaxed); }
+
+    result.p50  = quantile(counts, total, 0.5);
+    result.p99  = quantile(counts, total, 0.99);
+    result.p999 = quantile(counts, total, 0.999);
+    return result;
+  }
+
+private:
+
+  static constexpr auto sub_bucket_bits_ = std::size_t { 4 }; // 16 sub-buckets per power of two
+  static constexpr auto sub_bucket_mask_ = (std::uint64_t { 1 } << sub_bucket_bits_) - 1;
+  static constexpr auto bucket_count_    = std::size_t { (64 - sub_bucket_bits_ + 1) << sub_bucket_bits_ };
+
+  static std::size_t bucket_index(std::uint64_t value) noexcept
+  {
+    if (value <= sub_bucket_mask_) { return value; }
+
+    auto const msb = static_cast<std::size_t>(std::bit_width(value)) - 1;
+    auto const sub = (value >> (msb - sub_bucket_bits_)) & sub_bucket_mask_;
+    return ((msb - sub_bucket_bits_ + 1) << sub_bucket_bits_) + sub;
+  }
+
+  static std::chrono::nanoseconds bucket_lower_bound(std::size_t index) noexcept
+  {
+    if (index <= sub_bucket_mask_)
+    { return std::chrono::nanoseconds { static_cast<std::int64_t>(index) }; }
+
+    auto const msb = (index >> sub_bucket_bits_) + sub_bucket_bits_ - 1;
+    auto const sub = index & sub_bucket_mask_;
+    auto const value = (std::uint64_t { 1 } << msb) | (sub << (msb - sub_bucket_bits_));
+    return std::chrono::nanoseconds { static_cast<std::int64_t>(value) };
+  }
+
+  static std::chrono::nanoseconds quantile(std::array<std::uint64_t, bucket_count_> const& counts,
+                                           std::uint64_t total, double q) noexcept
+  {
+    if (total == 0) { return std::chrono::nanoseconds { 0 }; }
+
+    auto const target = std::max<std::uint64_t>(1,
+      static_cast<std::uint64_t>(q * static_cast<double>(total) + 0.5));
+
+    auto cumulative = std::uint64_t { 0 };
+    for (auto i = std::size_t { 0 }; i < bucket_count_; ++i)
+    {
+      cumulative += counts[i];
+      if (cumulative >= target) { return bucket_lower_bound(i); }
+    }
+    return bucket_lower_bound(bucket_count_ - 1);
+  }
+
+  std::array<std::atomic<std::uint64_t>, bucket_count_> counts_ { };
+  std::atomic<std::uint64_t> max_   { 0 };
+  std::atomic<std::uint64_t> count_ { 0 };
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_INSTRUMENT_HPP
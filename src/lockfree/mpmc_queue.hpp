@@ -0,0 +1,32 @@
+/****************************************************************************************\
+  @file      mpmc_queue.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_MPMC_QUEUE_HPP
+#define LOCKFREE_MPMC_QUEUE_HPP
+
+#include <cstddef>
+
+#include "mpmc_queue_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::mpmc_queue
+ * @extends lockfree::detail::mpmc_queue
+ */
+template<typename data_type, std::size_t queue_size>
+class mpmc_queue : public detail::mpmc_queue<data_type, queue_size>
+{
+  using super = detail::mpmc_queue<data_type, queue_size>;
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_MPMC_QUEUE_HPP
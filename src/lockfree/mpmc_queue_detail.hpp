@@ -0,0 +1,245 @@
+/****************************************************************************************\
+  @file      mpmc_queue_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_MPMC_QUEUE_DETAIL_HPP
+#define LOCKFREE_MPMC_QUEUE_DETAIL_HPP
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "queue.hpp"
+
+/****************************************************************************************\
+
+  A bounded MPMC (multi-producer-multi-consumer) ring in the style of Dmitry Vyukov's
+  bounded queue. Each slot carries a sequence counter that encodes whose turn it is to
+  access the slot, so producers and consumers coordinate without locks and without
+  touching each other's position counter. As with the SPSC queue, storage is entirely
+  in-object: no heap allocations and no virtuals.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, std::size_t queue_size>
+struct mpmc_queue__base
+{
+public:
+  static_assert(queue_size >= 2 && (queue_size & (queue_size - 1)) == 0,
+                "mpmc_queue requires a power-of-two queue_size");
+  static_assert(std::is_nothrow_default_constructible_v<data_type>);
+  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
+                std::is_nothrow_move_constructible_v<data_type>);
+
+  using type = data_type;
+
+  mpmc_queue__base() noexcept
+  {
+    // Slot i is initially "owned" by the producer of position i
+    for (auto i = std::size_t { 0 }; i < queue_size; ++i)
+    { slots_[i].sequence_.store(i, std::memory_order_relaxed); }
+  }
+
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_reference_t<U>, data_type>);
+
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+      auto & slot = slots_[pos & mask_];
+      auto   seq  = slot.sequence_.load(std::memory_order_acquire);
+      // Signed difference keeps the comparison correct if the counters ever wrap
+      auto   diff = static_cast<std::ptrdiff_t>(seq - pos);
+
+      if (diff == 0)
+      {
+        // It's our turn — claim the position. A weak CAS suffices; on failure we
+        // simply retry with the updated position.
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.data_ = std::forward<U>(elem);
+          // Hand the slot to the consumer of this position
+          slot.sequence_.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      { return false; } // the slot is still held by a consumer a lap behind: full
+      else
+      { pos = enqueue_pos_.load(std::memory_order_relaxed); } // lost a race; reload
+    }
+  }
+
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    static_assert(std::is_convertible_v<data_type, U>);
+
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+      auto & slot = slots_[pos & mask_];
+      auto   seq  = slot.sequence_.load(std::memory_order_acquire);
+      auto   diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+
+      if (diff == 0)
+      {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          elem = std::move(slot.data_);
+          // Hand the slot to the producer one lap ahead
+          slot.sequence_.store(pos + queue_size, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      { return false; } // the slot has not been published yet: empty
+      else
+      { pos = dequeue_pos_.load(std::memory_order_relaxed); }
+    }
+  }
+
+protected:
+  struct slot_t
+  {
+    std::atomic<std::size_t> sequence_ { 0 };
+    data_type data_ { };
+  };
+
+  static constexpr auto mask_ = queue_size - 1;
+
+  // As in queue__base, the position counters are kept off each other's (and the
+  // slots') cache lines.
+  alignas(cache_line_size) std::atomic<std::size_t> enqueue_pos_ { 0 };
+  alignas(cache_line_size) std::atomic<std::size_t> dequeue_pos_ { 0 };
+  alignas(cache_line_size) std::array<slot_t, queue_size> slots_ { };
+};
+
+/** A lockfree bounded MPMC queue
+ *
+ * Provides thread-safe push and pop operations for any number of concurrent producers
+ * and consumers, at a somewhat higher per-operation cost than the SPSC
+ * `lockfree::queue` (each operation performs one CAS on the shared position counter).
+ *
+ * The queue shares the `push`/`pop`/`push_range`/`pop_range` API surface of
+ * `lockfree::queue`. Note that because slots are claimed individually, the range
+ * operations are element-wise rather than single-publication batches.
+ *
+ * Requires:
+ * - `queue_size` is a power of two
+ * - `data_type` is no-throw default constructible
+ * - `data_type` is no-throw copy constructible or no-throw move constructible
+ *
+ * @tparam data_type The queue's internal storage type
+ * @tparam queue_size The maximum number of elements that the queue can hold at any time
+ */
+template<typename data_type, std::size_t queue_size>
+class mpmc_queue : public mpmc_queue__base<data_type, queue_size>
+{
+  using base = mpmc_queue__base<data_type, queue_size>;
+
+public:
+  /** The default constructor */
+  mpmc_queue() noexcept = default;
+
+  /** Initializer list constructor
+   *
+   * @param[in] list An initializer list containing elements of type `data_type` to push
+   *   to the queue
+   */
+  mpmc_queue(std::initializer_list<data_type> list) noexcept
+  {
+    push_range(std::begin(list), std::end(list));
+  }
+
+  /** Checks whether the queue is empty
+   *
+   * @returns `true` if the queue is empty, `false` otherwise
+   * @note The result is necessarily a snapshot when other threads are active.
+   */
+  bool empty() const noexcept
+  { return size() == 0; }
+
+  /** Returns the number of enqueued elements
+   *
+   * @note The result is necessarily a snapshot when other threads are active.
+   * @returns The number of elements in the queue
+   */
+  std::size_t size() const noexcept
+  {
+    auto enqueue_pos = this->enqueue_pos_.load();
+    auto dequeue_pos = this->dequeue_pos_.load();
+    return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+  }
+
+  /** Attempts to push a range of elements to the queue
+   *
+   * Stops at the first element that cannot be pushed (i.e. when the queue is full).
+   *
+   * @tparam Iterator Any input iterator dereferencing to an element convertible to
+   *   `data_type`
+   * @param[in] first An iterator marking the first element of the range to push
+   * @param[in] last An iterator demarking one element past the end of the range
+   * @returns The number of elements that were pushed
+   */
+  template<typename Iterator>
+  int push_range(Iterator first, Iterator last) noexcept
+  {
+    int count = 0;
+    for (; first != last; ++first, ++count)
+    { if (! base::push(*first)) break; }
+
+    return count;
+  }
+
+  /** Attempts to pop a range of elements from the queue
+   *
+   * Stops as soon as the queue is found empty.
+   *
+   * @tparam Iterator Any input iterator whose dereferenced type is assignable from
+   *   `data_type`
+   * @param[out] first An iterator marking the first element of the range to assign to
+   * @param[out] last An iterator demarking one element past the end of the range
+   * @returns The number of elements that were popped
+   */
+  template<typename Iterator>
+  int pop_range(Iterator first, Iterator last) noexcept
+  {
+    int count = 0;
+    for (; first != last; ++first, ++count)
+    { if (! base::pop(*first)) break; }
+
+    return count;
+  }
+
+  /** Convenience wrapper for mpmc_queue::pop(data_type&)
+   *
+   *  @returns optional containing element if pop was successfull, std::nullopt otherwise
+   */
+  std::optional<data_type> pop() noexcept
+  {
+    auto elem = data_type (/* default construct data_type */);
+    return base::pop(elem) ? std::optional<data_type> { std::move(elem) } : std::nullopt;
+  }
+
+  using base::push;
+  using base::pop;
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_MPMC_QUEUE_DETAIL_HPP
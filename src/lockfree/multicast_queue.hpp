@@ -0,0 +1,65 @@
+/****************************************************************************************\
+  @file      multicast_queue.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_MULTICAST_QUEUE_HPP
+#define LOCKFREE_MULTICAST_QUEUE_HPP
+
+#include "multicast_queue_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::multicast__base
+ * @extends lockfree::detail::multicast__base
+ */
+template<typename data_type,
+         std::size_t queue_size,
+         std::size_t max_consumers = 8,
+         enum data_write_policy = data_write_policy::no_overwrite,
+         enum memory_model = memory_model::acquire_release>
+class multicast_queue
+{
+};
+
+template<typename type, std::size_t size, std::size_t max_consumers, enum memory_model model>
+class multicast_queue<type, size, max_consumers, data_write_policy::overwrite, model>
+: public detail::multicast__overwrite_policy_t<type, size, max_consumers, model>
+{
+  using super = detail::multicast__overwrite_policy_t<type, size, max_consumers, model>;
+  using super::super; // inherit superclass constructors;
+
+public:
+
+  using consumer = detail::multicast_consumer<multicast_queue>;
+
+  /** Registers a consumer and returns the handle to poll the stream with */
+  consumer add_consumer() noexcept
+  { return consumer { this, super::register_consumer() }; }
+};
+
+
+template<typename type, std::size_t size, std::size_t max_consumers, enum memory_model model>
+class multicast_queue<type, size, max_consumers, data_write_policy::no_overwrite, model>
+: public detail::multicast__no_overwrite_policy_t<type, size, max_consumers, model>
+{
+  using super = detail::multicast__no_overwrite_policy_t<type, size, max_consumers, model>;
+  using super::super; // inherit superclass constructors;
+
+public:
+
+  using consumer = detail::multicast_consumer<multicast_queue>;
+
+  /** Registers a consumer and returns the handle to poll the stream with */
+  consumer add_consumer() noexcept
+  { return consumer { this, super::register_consumer() }; }
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_MULTICAST_QUEUE_HPP
@@ -0,0 +1,334 @@
+/****************************************************************************************\
+  @file      multicast_queue_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_MULTICAST_QUEUE_DETAIL_HPP
+#define LOCKFREE_MULTICAST_QUEUE_DETAIL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "queue_core.hpp"
+
+/****************************************************************************************\
+
+  A single-producer broadcast ring: the producer publishes each element once, and every
+  registered consumer reads the same slots through a private cursor. Fanning a stream
+  out to N consumers therefore costs one write and N reads, instead of the N writes
+  (and N producer-side cache lines) that pushing into N separate queues would.
+
+  Sequences are monotonic, so the ring size must be a power of two, and elements stay
+  in their slots until overwritten — slots are copy-assigned, never destroyed, which
+  is what lets N readers share them without an owner to run destructors.
+
+  The write policy decides what happens when the ring laps a consumer. Under
+  `no_overwrite` the producer gates on the slowest registered cursor (caching it the
+  same way `queue__base` caches the opposite index) and `push` fails while that
+  consumer is a full ring behind. Under `overwrite` the producer free-runs and a
+  lapped consumer resynchronizes to the oldest element still guaranteed intact,
+  validating each copy against the producer cursor afterwards to discard torn reads —
+  which is why that policy additionally requires a trivially copyable element type.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, std::size_t queue_size, std::size_t max_consumers,
+         memory_model model = memory_model::acquire_release>
+class multicast__base
+{
+public:
+
+  static_assert((queue_size & (queue_size - 1)) == 0,
+                "multicast sequences are monotonic, so the ring size must be a power of two");
+  static_assert(std::is_nothrow_default_constructible_v<data_type>);
+  static_assert(std::is_nothrow_copy_assignable_v<data_type> ||
+                std::is_nothrow_move_assignable_v<data_type>);
+  static_assert(max_consumers >= 1);
+
+  using type = data_type;
+
+  multicast__base() noexcept = default;
+
+  // Copying would duplicate live cursors out from under the registered consumers
+  multicast__base(multicast__base const&) = delete;
+  multicast__base & operator=(multicast__base const&) = delete;
+
+  /** The number of elements the ring holds */
+  static constexpr std::size_t capacity() noexcept
+  { return queue_size; }
+
+  /** Registers a consumer cursor, starting at the current head of the stream
+   *
+   * A consumer registered after production has begun sees only elements published
+   * after its registration. At most `max_consumers` consumers may register over the
+   * lifetime of the ring; cursor slots are never recycled.
+   *
+   * @returns The cursor index to poll with
+   */
+  std::size_t register_consumer() noexcept
+  {
+    auto const index = consumer_count_.load(order_relaxed_);
+    auto const start = cursor_.load(order_acquire_);
+
+    consumer_cursors_[index].sequence.store(start, order_relaxed_);
+    consumer_cursors_[index].published_cache = start;
+
+    // The count is bumped only once the cursor is initialized, so the producer's
+    // gate never observes a registered-but-uninitialized cursor.
+    consumer_count_.store(index + 1, order_release_);
+    return index;
+  }
+
+  /** The number of registered consumers */
+  std::size_t consumer_count() const noexcept
+  { return consumer_count_.load(order_acquire_); }
+
+  /** The number of published elements a consumer has yet to read */
+  std::size_t lag(std::size_t index) const noexcept
+  {
+    return cursor_.load(order_acquire_)
+         - consumer_cursors_[index].sequence.load(order_relaxed_);
+  }
+
+protected:
+
+  static constexpr std::size_t slot(std::size_t sequence) noexcept
+  { return sequence & (queue_size - 1); }
+
+  /** The slowest registered cursor — the gate for the `no_overwrite` producer
+   *
+   * With no consumers registered the producer gates on its own cursor, i.e. it
+   * free-runs and published elements are simply discarded.
+   */
+  std::size_t slowest() const noexcept
+  {
+    auto const count = consumer_count_.load(order_acquire_);
+    auto slowest = cursor_.load(order_relaxed_);
+
+    for (auto i = std::size_t { 0 }; i < count; ++i)
+    {
+      auto const sequence = consumer_cursors_[i].sequence.load(order_acquire_);
+      if (sequence < slowest) { slowest = sequence; }
+    }
+
+    return slowest;
+  }
+
+  // The orderings collapse to `seq_cst` under the conservative memory model.
+  static constexpr auto order_relaxed_ = model == memory_model::acquire_release
+    ? std::memory_order_relaxed : std::memory_order_seq_cst;
+  static constexpr auto order_acquire_ = model == memory_model::acquire_release
+    ? std::memory_order_acquire : std::memory_order_seq_cst;
+  static constexpr auto order_release_ = model == memory_model::acquire_release
+    ? std::memory_order_release : std::memory_order_seq_cst;
+
+  /** One cache line per consumer: the cursor the producer gates on, plus a plain
+   *  consumer-owned cache of the producer cursor sharing the same line.
+   */
+  struct alignas(cache_line_size) consumer_cursor_t
+  {
+    std::atomic<std::size_t> sequence       { 0 };
+    std::size_t              published_cache { 0 }; // consumer-owned
+  };
+
+  // The producer cursor (the next sequence to publish) and the producer-owned cache
+  // of the slowest consumer share the producer's line; every consumer cursor has a
+  // line of its own, as does the buffer.
+  alignas(cache_line_size) std::atomic<std::size_t> cursor_ { 0 };
+  std::size_t slowest_cache_ { 0 }; // producer-owned
+
+  alignas(cache_line_size) std::atomic<std::size_t> consumer_count_ { 0 };
+  std::array<consumer_cursor_t, max_consumers> consumer_cursors_ { };
+
+  alignas(cache_line_size) std::array<data_type, queue_size> buffer_ { };
+};
+
+
+/** CRTP-free policy layer selecting the lapping behaviour, mirroring
+ *  `data_write_policy_t` in the slotted queue.
+ */
+template<typename Base, data_write_policy policy>
+class multicast_write_policy_t;
+
+template<typename Base>
+class multicast_write_policy_t<Base, data_write_policy::no_overwrite> : public Base
+{
+public:
+
+  using Base::Base; // inherit superclass constructors;
+
+  /** Publishes an element, gating on the slowest registered consumer
+   *
+   * @returns `false` when the slowest consumer is a full ring behind
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_cvref_t<U>, typename Base::type>);
+
+    auto const sequence = this->cursor_.load(Base::order_relaxed_);
+
+    // The cached gate is conservative: a stale value can only under-report how far
+    // the consumers have advanced, so it is refreshed only when it claims full.
+    if (sequence - this->slowest_cache_ == Base::capacity())
+    {
+      this->slowest_cache_ = this->slowest();
+      if (sequence - this->slowest_cache_ == Base::capacity()) { return false; }
+    }
+
+    this->buffer_[Base::slot(sequence)] = std::forward<U>(elem);
+    this->cursor_.store(sequence + 1, Base::order_release_);
+    return true;
+  }
+
+  /** Copies the next unread element out for the given consumer cursor
+   *
+   * @returns `false` when the consumer has read everything published so far
+   */
+  template<typename U>
+  bool poll(std::size_t index, U & elem) noexcept
+  {
+    auto & state = this->consumer_cursors_[index];
+    auto const sequence = state.sequence.load(Base::order_relaxed_);
+
+    if (sequence == state.published_cache)
+    {
+      state.published_cache = this->cursor_.load(Base::order_acquire_);
+      if (sequence == state.published_cache) { return false; }
+    }
+
+    elem = this->buffer_[Base::slot(sequence)];
+    state.sequence.store(sequence + 1, Base::order_release_);
+    return true;
+  }
+};
+
+template<typename Base>
+class multicast_write_policy_t<Base, data_write_policy::overwrite> : public Base
+{
+public:
+
+  // A lapped consumer may copy a slot the producer is concurrently rewriting; the
+  // copy is discarded when validation fails, but it must at least be harmless.
+  static_assert(std::is_trivially_copyable_v<typename Base::type>,
+                "the overwrite policy tolerates (and discards) torn reads, which "
+                "requires a trivially copyable element type");
+
+  using Base::Base; // inherit superclass constructors;
+
+  /** Publishes an element unconditionally, lapping any consumer that falls behind
+   *
+   * Although this method never fails, we return true to be consistent with the API.
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_cvref_t<U>, typename Base::type>);
+
+    auto const sequence = this->cursor_.load(Base::order_relaxed_);
+    this->buffer_[Base::slot(sequence)] = std::forward<U>(elem);
+    this->cursor_.store(sequence + 1, Base::order_release_);
+    return true;
+  }
+
+  /** Copies the next unread element out for the given consumer cursor
+   *
+   * A consumer the producer has lapped resynchronizes to the oldest element still
+   * guaranteed intact (skipping everything it lost) rather than reading garbage.
+   *
+   * @returns `false` when the consumer has read everything published so far
+   */
+  template<typename U>
+  bool poll(std::size_t index, U & elem) noexcept
+  {
+    auto & state = this->consumer_cursors_[index];
+    auto sequence  = state.sequence.load(Base::order_relaxed_);
+    auto published = this->cursor_.load(Base::order_acquire_);
+
+    if (sequence == published) { return false; }
+
+    for (;;)
+    {
+      // `slot(sequence)` is rewritten once the producer begins publishing sequence
+      // `sequence + capacity`, so only cursors within `capacity - 1` of the head are
+      // guaranteed an untorn copy.
+      if (published - sequence >= Base::capacity())
+      { sequence = published - Base::capacity() + 1; }
+
+      elem = this->buffer_[Base::slot(sequence)];
+
+      // Validate after the copy: the fence keeps the re-load from being hoisted
+      // above it. The producer cursor is monotonic, so if it is still within a ring
+      // of `sequence` now, it was for the whole copy, and the copy is intact.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      published = this->cursor_.load(Base::order_relaxed_);
+
+      if (published - sequence < Base::capacity()) { break; }
+    }
+
+    state.sequence.store(sequence + 1, Base::order_release_);
+    return true;
+  }
+};
+
+
+/** A per-consumer handle over a multicast ring, combining the ring reference with the
+ *  cursor index returned by registration. Obtained from `add_consumer`; each handle
+ *  (like each cursor) belongs to exactly one consumer thread.
+ */
+template<typename ring_type>
+class multicast_consumer
+{
+public:
+
+  using type = typename ring_type::type;
+
+  /** Copies the next unread element out of the stream
+   *
+   * @returns `false` when this consumer has read everything published so far
+   */
+  bool poll(type & elem) noexcept
+  { return ring_->poll(index_, elem); }
+
+  /** The number of published elements this consumer has yet to read */
+  std::size_t lag() const noexcept
+  { return ring_->lag(index_); }
+
+private:
+
+  friend ring_type; // only the ring mints handles
+
+  multicast_consumer(ring_type * ring, std::size_t index) noexcept
+  : ring_ { ring }, index_ { index }
+  {
+  }
+
+  ring_type * ring_;
+  std::size_t index_;
+};
+
+
+template<typename type, std::size_t size, std::size_t max_consumers,
+         memory_model model = memory_model::acquire_release>
+using multicast__no_overwrite_policy_t =
+  class multicast_write_policy_t<multicast__base<type, size, max_consumers, model>,
+                                 data_write_policy::no_overwrite>;
+
+template<typename type, std::size_t size, std::size_t max_consumers,
+         memory_model model = memory_model::acquire_release>
+using multicast__overwrite_policy_t =
+  class multicast_write_policy_t<multicast__base<type, size, max_consumers, model>,
+                                 data_write_policy::overwrite>;
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_MULTICAST_QUEUE_DETAIL_HPP
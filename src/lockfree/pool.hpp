@@ -0,0 +1,31 @@
+/****************************************************************************************\
+  @file      pool.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_POOL_HPP
+#define LOCKFREE_POOL_HPP
+
+#include "pool_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::pool
+ * @extends lockfree::detail::pool
+ */
+template<typename data_type, std::size_t pool_size,
+         enum memory_model model = memory_model::acquire_release>
+class pool : public detail::pool<data_type, pool_size, model>
+{
+  using super = detail::pool<data_type, pool_size, model>;
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_POOL_HPP
@@ -0,0 +1,161 @@
+/****************************************************************************************\
+  @file      pool_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_POOL_DETAIL_HPP
+#define LOCKFREE_POOL_DETAIL_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "queue_core.hpp"
+
+/****************************************************************************************\
+
+  An SPSC object pool: `pool_size` elements with stable addresses and a wait-free
+  free-list between them, built on the same `queue__base` ring as the queue itself
+  (holding `data_type *`, for which every slot operation is trivial). The intended
+  topology is a producer/consumer pair's return path — the consumer `release`s
+  buffers that the producer `acquire`s for reuse — so the free-list's SPSC discipline
+  maps one-to-one onto the data queue's, and steady-state messaging allocates nothing.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, std::size_t pool_size,
+         memory_model model = memory_model::acquire_release>
+class pool
+{
+public:
+
+  // Elements are constructed once, up front, and live for the pool's lifetime.
+  static_assert(std::is_nothrow_default_constructible_v<data_type>);
+
+  /** Constructs the `pool_size` elements and places them all on the free-list */
+  pool() noexcept
+  {
+    for (auto & elem : elements_)
+    { free_list_.push(&elem); }
+  }
+
+  // The vended pointers refer into this object, so it must not move or be duplicated
+  pool(pool const&) = delete;
+  pool & operator=(pool const&) = delete;
+
+  /** A move-only guard that returns its element to the pool when destroyed */
+  class handle
+  {
+  public:
+    handle() noexcept = default;
+
+    handle(handle && other) noexcept
+    : pool_ { std::exchange(other.pool_, nullptr) }
+    , elem_ { std::exchange(other.elem_, nullptr) }
+    { }
+
+    handle & operator=(handle && other) noexcept
+    {
+      if (this != &other)
+      {
+        reset();
+        pool_ = std::exchange(other.pool_, nullptr);
+        elem_ = std::exchange(other.elem_, nullptr);
+      }
+      return *this;
+    }
+
+    handle(handle const&) = delete;
+    handle & operator=(handle const&) = delete;
+
+    ~handle() noexcept { reset(); }
+
+    /** Returns the element early; the handle becomes empty */
+    void reset() noexcept
+    {
+      if (elem_ != nullptr)
+      { std::exchange(pool_, nullptr)->release(std::exchange(elem_, nullptr)); }
+    }
+
+    data_type * get() const noexcept        { return elem_; }
+    data_type & operator*() const noexcept  { return *elem_; }
+    data_type * operator->() const noexcept { return elem_; }
+    explicit operator bool() const noexcept { return elem_ != nullptr; }
+
+  private:
+    friend class pool;
+
+    handle(pool * owner, data_type * elem) noexcept
+    : pool_ { owner }, elem_ { elem }
+    { }
+
+    pool * pool_      { nullptr };
+    data_type * elem_ { nullptr };
+  };
+
+  /** Takes an element off the free-list
+   *
+   * The pointer is stable for the pool's lifetime; the element retains whatever state
+   * its previous user left in it.
+   *
+   * @returns A pointer to an element, or `nullptr` when the pool is exhausted
+   * @note Wait-free. One acquiring thread only.
+   */
+  data_type * acquire() noexcept
+  {
+    auto elem = static_cast<data_type *>(nullptr);
+    free_list_.pop(elem);
+    return elem;
+  }
+
+  /** Like `acquire`, but wrapped in a guard that releases automatically
+   *
+   * The guard must be destroyed (or reset) on the releasing thread.
+   */
+  handle acquire_scoped() noexcept
+  {
+    return handle { this, acquire() };
+  }
+
+  /** Returns an element to the free-list
+   *
+   * @pre `elem` was obtained from this pool's `acquire()` and not yet released.
+   * @note Wait-free. One releasing thread only.
+   */
+  void release(data_type * elem) noexcept
+  {
+    free_list_.push(elem);
+  }
+
+  /** The number of elements the pool vends in total */
+  static constexpr std::size_t capacity() noexcept { return pool_size; }
+
+  /** The number of elements currently on the free-list
+   *
+   * @note As with `queue::size()`, only an instantaneous approximation while either
+   *   side is active.
+   */
+  std::size_t available() const noexcept
+  {
+    return free_list_.size();
+  }
+
+private:
+
+  // The free-list reuses the queue machinery verbatim; pointer elements make every
+  // slot operation trivial, so both sides stay wait-free.
+  queue_core<data_type *, pool_size, data_write_policy::no_overwrite, model> free_list_;
+
+  std::array<data_type, pool_size> elements_;
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_POOL_DETAIL_HPP
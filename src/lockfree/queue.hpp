@@ -10,29 +10,7 @@
 #ifndef LOCKFREE_QUEUE_HPP
 #define LOCKFREE_QUEUE_HPP
 
-#include <cstddef>
-#include <initializer_list>
-#include <optional>
-#include <type_traits>
-
-namespace lockfree {
-
-/** Polices for handling push operations when the queue is full
- *
- * The policy chosen for a given queue instantiation determines the behaviour of push
- * operations (except for those having the `_wait` suffix) that are requested whenever
- * the queue is full. The default is to `no_overwrite` if no policy is specified.
- */
-enum class data_write_policy
-{
-  /** While the queue is full, no new elements can be pushed to to it. */
-  no_overwrite,
-  /** While the queue is full, any new element that is pushed will overwrite the oldest element. */
-  overwrite
-};
-
-} // namespace lockfree
-
+#include "queue_core.hpp"
 #include "queue_detail.hpp"
 
 namespace lockfree {
@@ -40,28 +18,53 @@ namespace lockfree {
 /**
  * @copydoc lockfree::detail::queue
  * @extends lockfree::detail::queue
+ *
+ * The full interface: everything in `queue_core` plus the timed and blocking `_wait`
+ * operation families and the opt-in instrumentation policies. TUs that only need the
+ * hot API can include `queue_core.hpp` instead and skip this header's weight.
  */
 template<typename data_type,
          std::size_t queue_size,
-         enum data_write_policy = data_write_policy::no_overwrite>
+         enum data_write_policy = data_write_policy::no_overwrite,
+         enum memory_model = memory_model::acquire_release,
+         enum concurrency_policy = concurrency_policy::spsc,
+         enum instrumentation = instrumentation::none>
 class queue
 {
 };
 
-template<typename type, std::size_t size>
-class queue<type, size, data_write_policy::overwrite>
-: public detail::queue__overwrite_policy_t<type, size>
+template<typename type, std::size_t size, enum memory_model model,
+         enum concurrency_policy concurrency, enum instrumentation instr>
+class queue<type, size, data_write_policy::overwrite, model, concurrency, instr>
+: public detail::queue__overwrite_policy_t<type, size, model, concurrency, instr>
 {
-  using super = detail::queue__overwrite_policy_t<type, size>;
+  // The overwrite push reclaims slots from the consumer side, which is only sound
+  // when a single producer performs it and a single consumer observes it.
+  static_assert(concurrency == concurrency_policy::spsc,
+                "data_write_policy::overwrite requires the spsc concurrency policy");
+
+  // An overwritten element leaves its timestamp behind, desynchronizing the
+  // timestamp ring from the element ring.
+  static_assert(instr == instrumentation::none,
+                "data_write_policy::overwrite cannot be combined with instrumentation");
+
+  using super = detail::queue__overwrite_policy_t<type, size, model, concurrency, instr>;
   using super::super; // inherit superclass constructors;
 };
 
 
-template<typename type, std::size_t size>
-class queue<type, size, data_write_policy::no_overwrite>
-: public detail::queue__no_overwrite_policy_t<type, size>
+template<typename type, std::size_t size, enum memory_model model,
+         enum concurrency_policy concurrency, enum instrumentation instr>
+class queue<type, size, data_write_policy::no_overwrite, model, concurrency, instr>
+: public detail::queue__no_overwrite_policy_t<type, size, model, concurrency, instr>
 {
-  using super = detail::queue__no_overwrite_policy_t<type, size>;
+  // Both instrumentation policies rely on per-side state (the timestamp ring's
+  // sequence counters, the producer's cached read index), which requires a single
+  // thread on each side.
+  static_assert(instr == instrumentation::none || concurrency == concurrency_policy::spsc,
+                "instrumentation policies require the spsc concurrency policy");
+
+  using super = detail::queue__no_overwrite_policy_t<type, size, model, concurrency, instr>;
   using super::super; // inherit superclass constructors;
 };
 
@@ -0,0 +1,164 @@
+/****************************************************************************************\
+  @file      queue_core.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_QUEUE_CORE_HPP
+#define LOCKFREE_QUEUE_CORE_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <type_traits>
+
+/****************************************************************************************\
+
+  The minimal queue header: the hot API (push/pop/emplace/ranges/size/clear and the
+  front()/consume() idiom) with none of the timed, blocking, or instrumentation
+  machinery — so a TU that only moves data through the queue parses neither `<chrono>`
+  nor `<thread>`. Include `queue.hpp` instead where the `_wait` families or an
+  instrumentation policy are wanted; it provides the same queue under its usual name.
+
+\****************************************************************************************/
+
+namespace lockfree {
+
+/** Polices for handling push operations when the queue is full
+ *
+ * The policy chosen for a given queue instantiation determines the behaviour of push
+ * operations (except for those having the `_wait` suffix) that are requested whenever
+ * the queue is full. The default is to `no_overwrite` if no policy is specified.
+ */
+enum class data_write_policy
+{
+  /** While the queue is full, no new elements can be pushed to to it. */
+  no_overwrite,
+  /** While the queue is full, any new element that is pushed will overwrite the oldest element. */
+  overwrite
+};
+
+/** Policies governing the memory ordering used for index loads and stores
+ *
+ * The SPSC push/pop paths are correct under acquire/release ordering (with relaxed
+ * loads of an index on the thread that owns it), which avoids the full fences that
+ * `memory_order_seq_cst` implies on most architectures. The default is
+ * `acquire_release`; `seq_cst` is provided for users who prefer the conservative
+ * (pre-existing) behaviour.
+ */
+enum class memory_model
+{
+  /** Every index load and store is sequentially consistent. */
+  seq_cst,
+  /** Index loads/stores use acquire/release, relaxed where the index is thread-owned. */
+  acquire_release
+};
+
+/** The page backing requested for a heap-allocated ring (see `lockfree::dynamic_queue`)
+ *
+ * Large rings can suffer badly from TLB misses; backing them with 2MB huge pages
+ * removes most of that cost. `huge` asks for explicitly reserved huge pages and
+ * degrades gracefully (to the transparent hint, then to normal pages) when the system
+ * provides none; `transparent_huge` merely advises the kernel. On platforms without
+ * huge-page facilities all values behave as `normal`.
+ */
+enum class page_backing
+{
+  /** A plain aligned allocation with normal pages. */
+  normal,
+  /** A normal mapping with a transparent-huge-page (MADV_HUGEPAGE) hint. */
+  transparent_huge,
+  /** An explicit huge-page (MAP_HUGETLB) mapping, with graceful fallback. */
+  huge
+};
+
+/** Policies declaring how many threads may concurrently access each side of the queue
+ *
+ * The default `spsc` configuration keeps both push and pop wait-free but permits only
+ * one producer thread and one consumer thread. `mpsc` makes push safe for any number
+ * of producers (one CAS to reserve a slot, publication in reservation order) while the
+ * single consumer keeps the wait-free pop; `spmc` is the mirror image. Neither pays
+ * the full cost of an MPMC queue — for that, see `lockfree::mpmc_queue`.
+ */
+enum class concurrency_policy
+{
+  /** Exactly one producer thread and one consumer thread. */
+  spsc,
+  /** Any number of producer threads; exactly one consumer thread. */
+  mpsc,
+  /** Exactly one producer thread; any number of consumer threads. */
+  spmc
+};
+
+/** Opt-in observability policies
+ *
+ * The default `none` compiles to nothing: the instrumentation layer is an empty base
+ * class and the queue is byte-for-byte the uninstrumented one. `latency_histogram`
+ * timestamps each element on push and records its enqueue-to-dequeue latency on pop
+ * into an HDR-style histogram (see `instrument.hpp`), summarized on demand by
+ * `latency()` — cheap enough to leave enabled on a sampled fraction of production
+ * queues. Only `none` is available through `queue_core.hpp`; the active policies are
+ * defined alongside the extensions in `queue.hpp`.
+ */
+enum class instrumentation
+{
+  /** No instrumentation; zero overhead. */
+  none,
+  /** Per-element enqueue-to-dequeue latency, summarized by `latency()`. */
+  latency_histogram,
+  /** Push/pop outcome counters and a high-water mark, summarized by `stats()`. */
+  counters
+};
+
+} // namespace lockfree
+
+#include "queue_core_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::queue
+ * @extends lockfree::detail::queue
+ *
+ * The waiting-free core of `lockfree::queue`: the two types share every hot-path
+ * operation, but `queue_core` omits the `_wait` families (and their header weight).
+ */
+template<typename data_type,
+         std::size_t queue_size,
+         enum data_write_policy = data_write_policy::no_overwrite,
+         enum memory_model = memory_model::acquire_release,
+         enum concurrency_policy = concurrency_policy::spsc>
+class queue_core
+{
+};
+
+template<typename type, std::size_t size, enum memory_model model,
+         enum concurrency_policy concurrency>
+class queue_core<type, size, data_write_policy::overwrite, model, concurrency>
+: public detail::queue_core__overwrite_policy_t<type, size, model, concurrency>
+{
+  // The overwrite push reclaims slots from the consumer side, which is only sound
+  // when a single producer performs it and a single consumer observes it.
+  static_assert(concurrency == concurrency_policy::spsc,
+                "data_write_policy::overwrite requires the spsc concurrency policy");
+
+  using super = detail::queue_core__overwrite_policy_t<type, size, model, concurrency>;
+  using super::super; // inherit superclass constructors;
+};
+
+
+template<typename type, std::size_t size, enum memory_model model,
+         enum concurrency_policy concurrency>
+class queue_core<type, size, data_write_policy::no_overwrite, model, concurrency>
+: public detail::queue_core__no_overwrite_policy_t<type, size, model, concurrency>
+{
+  using super = detail::queue_core__no_overwrite_policy_t<type, size, model, concurrency>;
+  using super::super; // inherit superclass constructors;
+};
+
+} // namespace lockfree
+
+#endif // LOCKFREE_QUEUE_CORE_HPP
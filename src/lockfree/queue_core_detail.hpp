@@ -0,0 +1,1275 @@
+/****************************************************************************************\
+  @file      queue_core_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_QUEUE_CORE_DETAIL_HPP
+#define LOCKFREE_QUEUE_CORE_DETAIL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <functional>
+#include <memory>
+#include <span>
+#include <initializer_list>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+#include "../type_traits.hpp"
+
+/****************************************************************************************\
+
+  The core of the lock-free queue: everything behind the minimal interface provided in
+  `queue_core.hpp` (push/pop/size/clear and friends, no waiting). The timed and
+  blocking conveniences live in `queue_detail.hpp` so that TUs which only need the hot
+  API do not pay for `<chrono>`, `<thread>`, or the instrumentation machinery. The use
+  of `virtual` has intentionally been avoided to reduce runtime overhead, and the
+  queue relies entirely on stack allocations so as to avoid heap allocations as well.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+/** The alignment used to keep producer- and consumer-owned state on separate cache
+ *  lines. Falls back to 64 bytes where the standard constant is unavailable.
+ *
+ *  GCC warns on every use of the standard constant because its value can vary with
+ *  `-mtune`, making it ABI-hazardous in public headers. Here it only pads a
+ *  header-only type that is rebuilt with its users, so the warning is suppressed
+ *  rather than propagated into every including TU.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+
+#if defined(__cpp_lib_hardware_interference_size)
+inline constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#else
+inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+template<typename data_type, std::size_t queue_size,
+         memory_model model = memory_model::acquire_release>
+struct queue__base
+{
+public:
+  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
+                std::is_nothrow_move_constructible_v<data_type>);
+  static_assert(std::is_nothrow_destructible_v<data_type>);
+
+  using type = data_type; // simplifies implementation of data_write_policy_t
+
+  /** The default constructor
+   *
+   * The ring is backed by raw storage, so construction is O(1): no slot is
+   * default-constructed (or even touched) until an element is pushed into it.
+   */
+  queue__base() noexcept = default;
+
+  // Copying raw storage byte-wise would bypass element copy semantics
+  queue__base(queue__base const&) = delete;
+  queue__base & operator=(queue__base const&) = delete;
+
+  ~queue__base() noexcept
+  {
+    if constexpr (! std::is_trivially_destructible_v<data_type>)
+    {
+      auto read_index  = read_index_.load();
+      auto write_index = write_index_.load();
+
+      while (! is_empty(read_index, write_index))
+      {
+        destroy(read_index);
+        read_index = next_index(read_index);
+      }
+    }
+  }
+
+  template<typename U> // default behaviour is no-overwrite policy
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_reference_t<U>, data_type>);
+
+    // The producer owns `write_index_`, so its load can be relaxed; the load of
+    // `read_index_` must acquire so that the consumer's release of a freed slot
+    // happens-before our write into it.
+    auto old_write_index = write_index_.load(order_relaxed_);
+
+    // The cached read index is only ever behind the true one, so the queue can
+    // merely look full when it is not — refresh the cache before giving up. In the
+    // common case this avoids touching the consumer's line at all.
+    if (is_full(read_index_cache_, old_write_index))
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      if (is_full(read_index_cache_, old_write_index))
+      { return false; } // the queue is full
+    }
+
+    construct(old_write_index, std::forward<U>(elem));
+    write_index_.store(next_index(old_write_index), order_release_);
+    wake_consumer();
+    return true;
+  }
+
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    static_assert(std::is_convertible_v<data_type, U>);
+
+    auto old_read_index = read_index_.load(order_relaxed_);
+
+    // As in push, the cached write index can only lag behind, so the queue can
+    // merely look empty when it is not — refresh the cache before giving up.
+    if (is_empty(old_read_index, write_index_cache_))
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      if (is_empty(old_read_index, write_index_cache_))
+      { return false; } // queue is empty
+    }
+
+    // The element must be read out _before_ the slot is released to the producer,
+    // hence the read of the buffer precedes the (releasing) index store.
+    elem = std::move(*slot_ptr(old_read_index));
+    destroy(old_read_index);
+    read_index_.store(next_index(old_read_index), order_release_);
+    wake_producer();
+    return true;
+  }
+
+  /** Constructs an element directly in the next free slot
+   *
+   * Avoids the caller-side construct-then-copy that `push` requires. Fails (returning
+   * `false`) when the queue is full, regardless of the data write policy.
+   *
+   * @param args The arguments forwarded to the `data_type` constructor
+   * @returns `true` if the element was enqueued, `false` if the queue was full
+   */
+  template<typename... Args>
+  bool emplace(Args &&... args) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<data_type, Args...>);
+
+    auto old_write_index = write_index_.load(order_relaxed_);
+
+    if (is_full(read_index_cache_, old_write_index))
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      if (is_full(read_index_cache_, old_write_index))
+      { return false; }
+    }
+
+    construct(old_write_index, std::forward<Args>(args)...);
+    write_index_.store(next_index(old_write_index), order_release_);
+    wake_consumer();
+    return true;
+  }
+
+  /** Reserves the next free slot for in-place production
+   *
+   * The returned pointer remains valid, and the slot invisible to the consumer, until
+   * the producer publishes it with `commit()`. This enables zero-copy production —
+   * e.g. deserializing a network payload straight into ring memory.
+   *
+   * The slot's element is default-initialized (a no-op for trivial types) before the
+   * pointer is handed out, so the producer may write through it with plain
+   * assignment.
+   *
+   * @returns A pointer to the reserved slot, or `nullptr` when the queue is full
+   * @note Producer-thread only; at most one reservation may be outstanding.
+   */
+  data_type * reserve() noexcept
+  {
+    static_assert(std::is_nothrow_default_constructible_v<data_type>,
+                  "reserve() requires a default-constructible data_type; "
+                  "use emplace() otherwise");
+
+    auto old_write_index = write_index_.load(order_relaxed_);
+
+    if (is_full(read_index_cache_, old_write_index))
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      if (is_full(read_index_cache_, old_write_index))
+      { return nullptr; }
+    }
+
+    // Default-init (not value-init): trivial types are left untouched
+    return ::new (slot_address(old_write_index)) data_type;
+  }
+
+  /** Publishes the slot previously obtained from `reserve()`
+   *
+   * @pre A successful call to `reserve()` with no intervening push or commit.
+   * @note Producer-thread only.
+   */
+  void commit() noexcept
+  {
+    auto old_write_index = write_index_.load(order_relaxed_);
+    write_index_.store(next_index(old_write_index), order_release_);
+    wake_consumer();
+  }
+
+  /** Returns a pointer to the front (oldest) element without popping it
+   *
+   * The element remains owned by the queue; the consumer may read from or move out of
+   * it, then advance past it with `consume()`.
+   *
+   * @returns A pointer to the front element, or `nullptr` when the queue is empty
+   * @note Consumer-thread only.
+   */
+  data_type * front() noexcept
+  {
+    auto old_read_index = read_index_.load(order_relaxed_);
+
+    if (is_empty(old_read_index, write_index_cache_))
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      if (is_empty(old_read_index, write_index_cache_))
+      { return nullptr; }
+    }
+
+    return slot_ptr(old_read_index);
+  }
+
+  /** Destroys the front element and releases its slot back to the producer
+   *
+   * @pre A successful call to `front()` with no intervening pop or consume.
+   * @note Consumer-thread only.
+   */
+  void consume() noexcept
+  {
+    auto old_read_index = read_index_.load(order_relaxed_);
+    destroy(old_read_index);
+    read_index_.store(next_index(old_read_index), order_release_);
+    wake_producer();
+  }
+
+  /** A forward iterator over the readable region, for non-destructive observation
+   *
+   * Dereferencing yields `data_type const&` — elements stay owned (and live) in the
+   * queue. Obtained from `begin()`/`end()`.
+   */
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = data_type;
+    using pointer           = data_type const*;
+    using reference         = data_type const&;
+
+    const_iterator() noexcept = default;
+
+    reference operator*()  const noexcept { return *queue_->slot_ptr(index_); }
+    pointer   operator->() const noexcept { return  queue_->slot_ptr(index_); }
+
+    const_iterator & operator++() noexcept
+    {
+      index_ = next_index(index_);
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept
+    {
+      auto previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    friend bool operator==(const_iterator const& lhs, const_iterator const& rhs) noexcept
+    { return lhs.index_ == rhs.index_; }
+
+  private:
+    friend queue__base; // only the queue mints non-end iterators
+
+    const_iterator(queue__base * queue, std::size_t index) noexcept
+    : queue_ { queue }, index_ { index }
+    {
+    }
+
+    queue__base * queue_ { nullptr };
+    std::size_t   index_ { 0 };
+  };
+
+  /** Returns a pointer to the front (oldest) element without popping it
+   *
+   * Unlike `front()`, the element is exposed read-only: nothing is moved out and the
+   * read index never advances, so observation has no effect on the queue.
+   *
+   * @returns A pointer to the front element, or `nullptr` when the queue is empty
+   * @note Consumer-thread only; as with `size()`, the producer may publish more
+   *   elements at any moment, so emptiness is only a snapshot.
+   */
+  data_type const * peek() noexcept
+  { return front(); }
+
+  /** Returns a pointer to the element `offset` positions behind the front
+   *
+   * `peek(0)` is the front element, `peek(1)` the one behind it, and so on; offsets
+   * at or past the readable region yield `nullptr`.
+   *
+   * @returns A pointer to the requested element, or `nullptr` when out of range
+   * @note Consumer-thread only; see `peek()`.
+   */
+  data_type const * peek(std::size_t offset) noexcept
+  {
+    auto const old_read_index = read_index_.load(order_relaxed_);
+
+    // The cached write index can only under-report the readable region, so it is
+    // refreshed only when the requested offset appears out of range.
+    if (offset >= occupancy(old_read_index, write_index_cache_))
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      if (offset >= occupancy(old_read_index, write_index_cache_))
+      { return nullptr; }
+    }
+
+    return slot_ptr(advance_index(old_read_index, offset));
+  }
+
+  /** Returns an iterator over a snapshot of the readable region
+   *
+   * The bounds are fixed when `begin()` is called: elements published afterwards are
+   * not visited (they lie past `end()`), which is what makes concurrent production
+   * harmless. Iteration does not consume — the read index never advances.
+   *
+   * @note Consumer-thread only, like `front()`: any pop or consume from another
+   *   thread could destroy an element mid-visit. As with `size()`, the snapshot is
+   *   already stale by the time it is observed.
+   */
+  const_iterator begin() noexcept
+  {
+    auto const old_read_index = read_index_.load(order_relaxed_);
+    write_index_cache_ = write_index_.load(order_acquire_); // pin the snapshot bound
+    return { this, old_read_index };
+  }
+
+  /** The end of the snapshot fixed by the preceding `begin()` */
+  const_iterator end() noexcept
+  { return { this, write_index_cache_ }; }
+
+  template<typename Iterator> // genuine batch push: one index publication per call
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<data_type, decltype(*first)>);
+
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const old_write_index = write_index_.load(order_relaxed_);
+
+    // Compute the free region once, refreshing the cached read index only if it
+    // does not already show enough room for the whole range.
+    auto free_slots = queue_size - occupancy(read_index_cache_, old_write_index);
+    if (free_slots < requested)
+    {
+      read_index_cache_ = read_index_.load(order_acquire_);
+      free_slots = queue_size - occupancy(read_index_cache_, old_write_index);
+    }
+
+    auto const count = std::min(requested, free_slots);
+
+    auto index = old_write_index;
+
+    if constexpr (is_memcpyable_range_<Iterator>)
+    {
+      // Trivially copyable elements from a contiguous range go in with at most two
+      // memcpy chunks, split at the buffer wrap; for an implicit-lifetime type the
+      // copy itself begins the slots' lifetimes.
+      auto copied = std::size_t { 0 };
+      while (copied < count)
+      {
+        auto const chunk = std::min(count - copied, buffer_size_ - slot(index));
+        std::memcpy(slot_address(index), std::to_address(first) + copied,
+                    chunk * sizeof(data_type));
+        copied += chunk;
+        index   = advance_index(index, chunk);
+      }
+    }
+    else
+    {
+      for (auto i = std::size_t { 0 }; i < count; ++i)
+      {
+        construct(index, *first++);
+        index = next_index(index);
+      }
+    }
+
+    write_index_.store(index, order_release_);
+    if (count > 0) { wake_consumer(); }
+    return count;
+  }
+
+  template<typename Iterator> // genuine batch pop: one index publication per call
+  std::size_t pop_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_assignable_v<decltype(*first), data_type>);
+
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const old_read_index = read_index_.load(order_relaxed_);
+
+    auto available = occupancy(old_read_index, write_index_cache_);
+    if (available < requested)
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      available = occupancy(old_read_index, write_index_cache_);
+    }
+
+    auto const count = std::min(requested, available);
+
+    auto index = old_read_index;
+
+    if constexpr (is_memcpyable_range_<Iterator>)
+    {
+      // The mirror of the push_range fast path: at most two memcpy chunks out, and
+      // nothing to destroy (trivially copyable implies trivially destructible).
+      auto copied = std::size_t { 0 };
+      while (copied < count)
+      {
+        auto const chunk = std::min(count - copied, buffer_size_ - slot(index));
+        std::memcpy(std::to_address(first) + copied, slot_address(index),
+                    chunk * sizeof(data_type));
+        copied += chunk;
+        index   = advance_index(index, chunk);
+      }
+    }
+    else
+    {
+      for (auto i = std::size_t { 0 }; i < count; ++i)
+      {
+        *first++ = std::move(*slot_ptr(index));
+        destroy(index);
+        index = next_index(index);
+      }
+    }
+
+    read_index_.store(index, order_release_);
+    if (count > 0) { wake_producer(); }
+    return count;
+  }
+
+  /** Pops and applies `fn` to up to `max_elems` elements, publishing the index once
+   *
+   * The batch equivalent of repeated `consume_with` calls: the available region is
+   * determined up front (the write index is loaded at most twice), the functor is
+   * invoked over every element in buffer order — a loop the compiler can vectorize —
+   * and `read_index_` is published exactly once at the end.
+   *
+   * @tparam Fn A callable accepting a (moved-from) `data_type`
+   * @param[in] max_elems The maximum number of elements to consume
+   * @param fn The function applied to each consumed element
+   * @returns The number of elements consumed
+   */
+  template<typename Fn>
+  std::size_t consume_up_to(std::size_t max_elems, Fn && fn)
+  {
+    auto const old_read_index = read_index_.load(order_relaxed_);
+
+    auto available = occupancy(old_read_index, write_index_cache_);
+    if (available < max_elems)
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      available = occupancy(old_read_index, write_index_cache_);
+    }
+
+    auto const count = std::min(max_elems, available);
+
+    auto index = old_read_index;
+    for (auto i = std::size_t { 0 }; i < count; ++i)
+    {
+      std::invoke(fn, std::move(*slot_ptr(index)));
+      destroy(index);
+      index = next_index(index);
+    }
+
+    read_index_.store(index, order_release_);
+    if (count > 0) { wake_producer(); }
+    return count;
+  }
+
+  /** Pops and applies `fn` to every currently available element
+   *
+   * @copydetails consume_up_to
+   */
+  template<typename Fn>
+  std::size_t consume_all(Fn && fn)
+  {
+    return consume_up_to(queue_size, std::forward<Fn>(fn));
+  }
+
+  /** A zero-copy view over the contiguous readable region
+   *
+   * The span covers the elements from the front of the queue up to the buffer wrap,
+   * so at most two calls (with a `release` in between) see everything readable. The
+   * buffer itself is cache-line (64-byte) aligned, so a span starting at slot zero
+   * is suitably aligned for SIMD kernels run directly over in-ring data; pair with
+   * `release()` to retire the elements once processed.
+   *
+   * Only available for trivially copyable element types, since the view bypasses
+   * element access semantics the same way the memcpy batch paths do.
+   *
+   * @returns A view of the front-most contiguous readable elements (possibly empty)
+   * @note Consumer-thread only.
+   */
+  std::span<data_type const> readable_span() noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<data_type>,
+                  "readable_span() exposes raw slots, which requires a trivially "
+                  "copyable data_type");
+
+    auto const read = read_index_.load(order_relaxed_);
+
+    // As in pop, the cached write index can only under-report; refresh it only when
+    // it shows nothing to read.
+    auto available = occupancy(read, write_index_cache_);
+    if (available == 0)
+    {
+      write_index_cache_ = write_index_.load(order_acquire_);
+      available = occupancy(read, write_index_cache_);
+    }
+
+    auto const contiguous = std::min(available, buffer_size_ - slot(read));
+    return { slot_ptr(read), contiguous };
+  }
+
+  /** Retires the front-most `count` elements without copying them out
+   *
+   * The counterpart of `readable_span()`: after processing elements in place, their
+   * slots are returned to the producer with a single index publication.
+   *
+   * @pre `count` is no greater than the size of the last `readable_span()`
+   * @note Consumer-thread only.
+   */
+  void release(std::size_t count) noexcept
+  {
+    static_assert(std::is_trivially_destructible_v<data_type>,
+                  "release() skips element destruction, which requires a trivially "
+                  "destructible data_type");
+
+    auto const read = read_index_.load(order_relaxed_);
+    read_index_.store(advance_index(read, count), order_release_);
+    if (count > 0) { wake_producer(); }
+  }
+
+protected:
+  /** Wakes a consumer parked in a blocking pop or a suspended `co_pop`, if one has
+   *  registered itself
+   *
+   * The hot path pays only a (rarely-changing, thus cache-resident) flag load and a
+   * predictable branch per wait mode; the notify syscall (or coroutine resumption) is
+   * reached only when a waiter is parked. Compiles to nothing where neither C++20
+   * atomic waiting nor coroutines are available.
+   *
+   * @note A parked coroutine is resumed inline, i.e. on the thread that performed the
+   *   push — the consumer role migrates with the resumption.
+   */
+  void wake_consumer() noexcept
+  {
+#if defined(__cpp_lib_atomic_wait)
+    if (consumer_waiting_.load(std::memory_order_seq_cst))
+    {
+      consumer_waiting_.store(false, std::memory_order_relaxed);
+      write_index_.notify_one();
+    }
+#endif
+#if defined(__cpp_impl_coroutine)
+    if (parked_consumer_.load(std::memory_order_seq_cst) != nullptr)
+    {
+      // The exchange settles the race against the awaiter reclaiming its own handle.
+      if (auto const parked = parked_consumer_.exchange(nullptr, std::memory_order_seq_cst))
+      { std::coroutine_handle<>::from_address(parked).resume(); }
+    }
+#endif
+  }
+
+  /** The producer-side counterpart of `wake_consumer` */
+  void wake_producer() noexcept
+  {
+#if defined(__cpp_lib_atomic_wait)
+    if (producer_waiting_.load(std::memory_order_seq_cst))
+    {
+      producer_waiting_.store(false, std::memory_order_relaxed);
+      read_index_.notify_one();
+    }
+#endif
+#if defined(__cpp_impl_coroutine)
+    if (parked_producer_.load(std::memory_order_seq_cst) != nullptr)
+    {
+      if (auto const parked = parked_producer_.exchange(nullptr, std::memory_order_seq_cst))
+      { std::coroutine_handle<>::from_address(parked).resume(); }
+    }
+#endif
+  }
+  /** Whether this instantiation uses monotonically increasing indices
+   *
+   * Power-of-two queue sizes use monotonically increasing indices mapped onto the
+   * buffer with a bitwise AND, which removes both the (mispredicted-around-wrap)
+   * branch in `next_index` and the `%` in `size()`. Other sizes keep the original
+   * modular scheme with its one spare slot.
+   */
+  static constexpr bool uses_monotonic_indices_ =
+    queue_size >= 2 && (queue_size & (queue_size - 1)) == 0;
+
+  static constexpr auto buffer_size_ = uses_monotonic_indices_ ? queue_size
+                                                               : queue_size + 1;
+
+  /** Maps an index onto its position in `buffer_` */
+  static constexpr auto slot(std::size_t index) noexcept -> std::size_t
+  {
+    if constexpr (uses_monotonic_indices_) { return index & (buffer_size_ - 1); }
+    else                                   { return index; }
+  }
+
+  static constexpr auto next_index(std::size_t index) noexcept -> std::size_t
+  {
+    if constexpr (uses_monotonic_indices_) { return index + 1; }
+    else { return ++index == buffer_size_ ? 0 : index; }
+  }
+
+  /** Advances an index by `count` positions; the batch counterpart of `next_index` */
+  static constexpr auto advance_index(std::size_t index, std::size_t count) noexcept
+    -> std::size_t
+  {
+    if constexpr (uses_monotonic_indices_) { return index + count; }
+    else                                   { return (index + count) % buffer_size_; }
+  }
+
+  /** Whether the batch paths may bypass element semantics with raw memcpy */
+  template<typename Iterator>
+  static constexpr bool is_memcpyable_range_ =
+    std::is_trivially_copyable_v<data_type> &&
+    std::contiguous_iterator<Iterator> &&
+    std::is_same_v<std::remove_cvref_t<std::iter_reference_t<Iterator>>, data_type>;
+
+  /** The number of enqueued elements implied by a read/write index pair */
+  static constexpr auto occupancy(std::size_t read_index, std::size_t write_index)
+    noexcept -> std::size_t
+  {
+    // Monotonic indices may wrap around SIZE_MAX; unsigned subtraction remains exact
+    if constexpr (uses_monotonic_indices_) { return write_index - read_index; }
+    else { return (buffer_size_ - read_index + write_index) % buffer_size_; }
+  }
+
+  static constexpr bool is_full(std::size_t read_index, std::size_t write_index) noexcept
+  {
+    if constexpr (uses_monotonic_indices_)
+    { return write_index - read_index == queue_size; }
+    else
+    { return next_index(write_index) == read_index; }
+  }
+
+  static constexpr bool is_empty(std::size_t read_index, std::size_t write_index) noexcept
+  { return read_index == write_index; }
+
+  /** The address of the (possibly lifetime-less) slot for a given index */
+  void * slot_address(std::size_t index) noexcept
+  { return storage_ + slot(index) * sizeof(data_type); }
+
+  /** A pointer to the live element occupying the slot for a given index */
+  data_type * slot_ptr(std::size_t index) noexcept
+  { return std::launder(reinterpret_cast<data_type *>(slot_address(index))); }
+
+  /** Begins the lifetime of an element in the slot for a given index */
+  template<typename... Args>
+  data_type * construct(std::size_t index, Args &&... args) noexcept
+  { return ::new (slot_address(index)) data_type ( std::forward<Args>(args)... ); }
+
+  /** Ends the lifetime of the element occupying the slot for a given index */
+  void destroy(std::size_t index) noexcept
+  { slot_ptr(index)->~data_type(); }
+
+  // The orderings collapse to `seq_cst` under the conservative memory model.
+  static constexpr auto order_relaxed_ = model == memory_model::acquire_release
+    ? std::memory_order_relaxed : std::memory_order_seq_cst;
+  static constexpr auto order_acquire_ = model == memory_model::acquire_release
+    ? std::memory_order_acquire : std::memory_order_seq_cst;
+  static constexpr auto order_release_ = model == memory_model::acquire_release
+    ? std::memory_order_release : std::memory_order_seq_cst;
+
+  // Each index lives on its own cache line, and the buffer on lines of its own, so
+  // that the producer and consumer cores never false-share a line through this
+  // class. The class alignment (and hence its size) is rounded up accordingly.
+  // The cached copies of the opposite side's index are plain (non-atomic) values
+  // owned by one thread only, and deliberately share that thread's own index line.
+  alignas(cache_line_size) std::atomic<std::size_t> read_index_  { 0 };
+  std::size_t write_index_cache_ { 0 }; // consumer-owned
+  alignas(cache_line_size) std::atomic<std::size_t> write_index_ { 0 };
+  std::size_t read_index_cache_ { 0 };  // producer-owned
+
+#if defined(__cpp_lib_atomic_wait)
+  // Parked-waiter flags for the blocking wait mode. Each flag is written only around
+  // parking and read by the opposite side's hot path, so it stays cache-resident in
+  // the Shared state except during the (rare) empty/full transitions that matter.
+  alignas(cache_line_size) std::atomic<bool> consumer_waiting_ { false };
+  alignas(cache_line_size) std::atomic<bool> producer_waiting_ { false };
+#endif
+
+#if defined(__cpp_impl_coroutine)
+  // Parked coroutine handles for the awaitable wait mode, with the same line and
+  // cost discipline as the flags above. Type-erased as `void*` so the core header
+  // needs nothing from the awaitable types layered on in `queue_detail.hpp`.
+  alignas(cache_line_size) std::atomic<void*> parked_consumer_ { nullptr };
+  alignas(cache_line_size) std::atomic<void*> parked_producer_ { nullptr };
+#endif
+
+  // Raw slot storage: elements are placement-new'd on push and destroyed on pop, so
+  // data_type need not be default constructible and no slot is touched before use.
+  // Because every pop/consume path ends the slot's lifetime immediately (rather than
+  // leaving a moved-from object behind), resources owned by elements are released as
+  // they leave the ring: memory footprint tracks occupancy, not capacity.
+  alignas(alignof(data_type) > cache_line_size ? alignof(data_type) : cache_line_size)
+  std::byte storage_[buffer_size_ * sizeof(data_type)];
+};
+
+static_assert(cache_line_size >= 2*sizeof(std::atomic<std::size_t>),
+              "indices must not be packed onto a single line by the fallback value");
+
+/** A lockfree SPSC queue implementation
+ *
+ * Provides thread-safe push and pop operations when used in an SPSC
+ * (single-producer-single-consumer) configuration.
+ *
+ * The queue is implemented using a ring-buffer that is a statically allocated to be of
+ * size `queue_size+1`, which provides a convenient means of deterimining the buffer's
+ * empty and full states:
+ *
+ * `queue_is_full &nbsp;<-- read_index+1 == write_index`<br>
+ * `queue_is_empty <-- read_index &nbsp;&nbsp;== write_index`
+ *
+ * Where `queue_size` is a power of two the buffer is instead exactly `queue_size`
+ * elements and the indices increase monotonically, with the buffer position obtained
+ * by a bitwise AND — removing the wrap branch and the `%` in `size()`. The choice is
+ * made at compile time and does not affect the interface.
+ *
+ * The buffer is raw storage: elements are constructed in place on push and destroyed
+ * on pop, so creating a queue is O(1) regardless of capacity and `data_type` need not
+ * be default constructible. (Methods that hand back an element by value — `pop()`,
+ * `pop_wait()` — do require default constructibility, and are only instantiated when
+ * used.)
+ *
+ * Requires:
+ * - `data_type` is no-throw copy constructible or no-throw move constructible
+ * - `data_type` is no-throw destructible
+ *
+ * Note:
+ * - Not all methods are thread-safe. Methods that are not thread-safe are documented as
+ * such.
+ *
+ * Sources that helped me:
+ * - Timur Doumler - C++ in the Audio Industry talks [CppCon, Juce]
+ * - Anthony Williams - C++ Concurrency in Action [Manning]
+ *
+ * @tparam data_type The queue's internal storage type
+ * @tparam queue_size The maximum number of elements that the queue can hold at any time
+ * @tparam data_write_policy The policy governing the behaviour of push operations (except
+ *   for those having the suffix `_wait`) when the queue is full
+ */
+template<typename data_type, std::size_t queue_size, typename Policy>
+class queue : public Policy
+{
+public:
+  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
+                std::is_nothrow_move_constructible_v<data_type>);
+
+/****************************************************************************************\
+  Object lifetime
+\****************************************************************************************/
+
+  /** The default constructor */
+  queue() noexcept = default;
+
+  /** Initializer list constructor
+   *
+   * Enables static initialization of the queue with up to `queue_size` elements provided
+   * by an initializer list.
+   *
+   * @param[in] list An initializer list containing elements of type `data_type` to push
+   *   to the queue
+   */
+  queue(std::initializer_list<data_type> list) noexcept
+  {
+    push_range(std::begin(list), std::end(list));
+  }
+
+/****************************************************************************************\
+  Queue operations
+\****************************************************************************************/
+
+  /** Checks whether the queue is empty
+   *
+   * Returns a `bool` denoting whether the queue is empty or not.
+   *
+   * @returns `true if the queue is empty, `false` otherwise
+   * @note not thread-safe
+   */
+  bool empty() const noexcept
+  {
+    return this->read_index_.load() == this->write_index_.load();
+  }
+
+  /** Checks whether the queue is full
+   *
+   * Returns a `bool` denoting whether the queue is full or not.
+   *
+   * @returns `true` if the queue is full, `false` otherwise
+   */
+  bool full() const noexcept
+  {
+    return this->is_full(this->read_index_.load(), this->write_index_.load());
+  }
+
+  /** Returns the number of enqueued elements
+   *
+   * @note This operation is not thread-safe.
+   *
+   * @returns The number of elements in the queue
+   */
+  std::size_t size() const noexcept
+  {
+    return this->occupancy(this->read_index_.load(), this->write_index_.load());
+  }
+
+  /** Discards the enqueued elements.
+   *
+   *  Each discarded element is destroyed, so its slot holds no live object afterwards.
+   *
+   *  @post The queue is empty.
+   *  @note May only be called from the consumer thread.
+   */
+  void clear() noexcept
+  {
+    while (this->front() != nullptr)
+    { this->consume(); }
+  }
+
+  /** Pushes an element to the queue
+   *
+   * Attempts to push an element to the queue, returning `true` when successful,
+   * otherwise `false`. The exact behaviour depends upon the queue's `data_write_policy`.
+   * Where the policy is set to `no_overwrite` (default), and the queue is full, the
+   * operation will fail, and `false` is returned. Where the the policy is set to
+   * `overwrite` the operation will never fail, simply writing over the next value when
+   * space is needed.
+   *
+   * @tparam U Either `data_type` or a type that is convertible to `data_type`
+   * @param[in] elem The data element to be placed on the queue
+   * @returns `true` if the operation was successfull, `false` otherwise
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    return Policy::push( std::forward<U>(elem) );
+  }
+
+
+  /** Attempts to push a range of elements to the queue
+   *
+   * Attempts to push all the elements of the given range. If the queue fills up before
+   * the entire range is pushed, then subsequent attempts to push new elements are
+   * dependent on the queue's data write policy. If the `no_overwrite` policy has been
+   * specified, then the operation stops. Otherwise, with each successive push the oldest
+   * element will be overwritten until the operation completes.
+   *
+   * With the `no_overwrite` policy the operation is a genuine batch: the free region
+   * is computed once, the elements are copied in bulk, and the write index is
+   * published exactly once rather than per element.
+   *
+   * @tparam Iterator Any type that supports the features of an input iterator and which
+   *   dereferences to an element of type `data_type`
+   * @param[in] first An iterator marking the first element of the range to push
+   * @param[in] last An iterator that abuts the last element of the range
+   * @returns The number of elements that were pushed
+   */
+  template<typename Iterator>
+  int push_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_constructible_v<data_type, decltype(*first)>);
+
+    return static_cast<int>( Policy::push_range(first, last) );
+  }
+
+  /** Pops an element from the queue
+   *
+   * Removes the next element from the queue, assigning it to a given reference. When the
+   * queue contains one or more elements the operation will complete successfully it will
+   * save the popped value to the given reference and return `true`, otherwise it will
+   * simply return `false`.
+   *
+   * @tparam U Either `data_type` or a type that is assignable from `data_type`
+   * @param[out] elem The location to which the popped element will be assigned
+   * @returns `true` if the pop was successful, `false` otherwise
+   */
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    return Policy::pop(elem);
+  }
+
+  /** Convenience wrapper for queue::pop(data_type&)
+   *
+   *  @returns optional containing element if pop was successfull, std::nullopt otherwise
+   */
+  std::optional<data_type> pop() noexcept
+  {
+    auto elem = data_type (/* default construct data_type */);
+    return Policy::pop(elem) ? std::optional<data_type> { std::move(elem) } : std::nullopt;
+  }
+
+  /** Attempts to pops a range of elements from the queue
+   *
+   * Attempts to fill all the elements of a given range. If the queue empties before the
+   * entire range is filled, then the method returns.
+   *
+   * The operation is a genuine batch: the available region is computed once, the
+   * elements are moved out in bulk, and the read index is published exactly once.
+   *
+   * @tparam Iterator Any type that meets the requirements for an input iterator and
+   *   whose dereferenced type can be assigned by by an element of type `data_type`.
+   * @param[out] first An iterator marking the first elementof the range to assign
+   *   popped elements to
+   * @param[out] last An iterator that abuts the last element of the range
+   */
+  template<typename Iterator>
+  int pop_range(Iterator first, Iterator last) noexcept
+  {
+    static_assert(std::is_nothrow_assignable_v<decltype(*first), data_type>);
+
+    return static_cast<int>( Policy::pop_range(first, last) );
+  }
+
+  /** Pops an element from the queue then applies a given function to it
+   *
+   * The provided function may optionally be called with a list of arguments that are
+   * supplied to it following the popped element.
+   *
+   * @tparam Fn Function's type
+   * @tparam Args The sequence of function argument types, less `data_type`
+   * @param fn The function to apply
+   * @param args The functions arguments
+   */
+  template <typename Fn, typename... Args>
+  bool consume_with(Fn && fn, Args &&... args)
+  {
+    auto elem = data_type (/* default construct data_type */);
+    if (Policy::pop(elem))
+    {
+      std::invoke(std::forward<Fn>(fn), std::move(elem), std::forward<Args>(args)...);
+      return true;
+    }
+
+    return false;
+  }
+
+}; // class queue
+
+
+template<typename Base, enum concurrency_policy>
+class concurrency_policy_t;
+
+
+/** The default SPSC configuration adds nothing to `queue__base` */
+template<typename Base>
+class concurrency_policy_t<Base, concurrency_policy::spsc> : public Base
+{
+protected:
+  // Lets the single-parker wait families constrain themselves to configurations
+  // with one thread on the parking side.
+  static constexpr auto concurrency_ = concurrency_policy::spsc;
+};
+
+
+template<typename Base>
+class concurrency_policy_t<Base, concurrency_policy::mpsc> : public Base
+{
+public:
+
+  /**
+   *  Multi-producer push: a slot is reserved with a CAS on a producer-shared
+   *  reservation counter, written, and then published in reservation order. A
+   *  producer that reserved later spins briefly until its predecessor has published,
+   *  so push is lock-free rather than wait-free in this configuration.
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_reference_t<U>, typename Base::type>);
+
+    auto pos = write_reserve_.load(std::memory_order_relaxed);
+    do
+    {
+      // The cached read index is single-producer state and cannot be used here
+      if (Base::is_full(this->read_index_.load(std::memory_order_acquire), pos))
+      { return false; }
+    }
+    while (! write_reserve_.compare_exchange_weak(pos, Base::next_index(pos),
+                                                  std::memory_order_relaxed));
+
+    this->construct(pos, std::forward<U>(elem));
+
+    while (this->write_index_.load(std::memory_order_acquire) != pos)
+    { /* a predecessor is still publishing its element */ }
+
+    this->write_index_.store(Base::next_index(pos), std::memory_order_release);
+
+    // This path replaces `Base::push` wholesale, so it must wake parked waiters
+    // itself — the (single) consumer may be blocked or suspended on emptiness.
+    this->wake_consumer();
+    return true;
+  }
+
+  /**
+   *  Slots are claimed individually by competing producers, so the range cannot be
+   *  published as a single batch.
+   */
+  template<typename Iterator>
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    auto count = std::size_t { 0 };
+    for (; first != last; ++first, ++count)
+    { if (! push(*first)) break; }
+
+    return count;
+  }
+
+protected:
+  static constexpr auto concurrency_ = concurrency_policy::mpsc;
+
+  alignas(cache_line_size) std::atomic<std::size_t> write_reserve_ { 0 };
+
+private:
+  // The single-producer producer-side idioms advance `write_index_` without touching
+  // `write_reserve_`, desynchronizing the two and livelocking the next push, so they
+  // are hidden in this configuration (the convention here is to reject unsound
+  // combinations at compile time).
+  using Base::emplace;
+  using Base::reserve;
+  using Base::commit;
+};
+
+
+template<typename Base>
+class concurrency_policy_t<Base, concurrency_policy::spmc> : public Base
+{
+public:
+
+  /**
+   *  Multi-consumer pop: the mirror image of the mpsc push — a CAS reserves the next
+   *  readable slot, the element is moved out, and the read index is released to the
+   *  producer in reservation order.
+   */
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    static_assert(std::is_convertible_v<typename Base::type, U>);
+
+    auto pos = read_reserve_.load(std::memory_order_relaxed);
+    do
+    {
+      if (Base::is_empty(pos, this->write_index_.load(std::memory_order_acquire)))
+      { return false; }
+    }
+    while (! read_reserve_.compare_exchange_weak(pos, Base::next_index(pos),
+                                                 std::memory_order_relaxed));
+
+    elem = std::move(*this->slot_ptr(pos));
+    this->destroy(pos);
+
+    while (this->read_index_.load(std::memory_order_acquire) != pos)
+    { /* a predecessor is still moving its element out */ }
+
+    this->read_index_.store(Base::next_index(pos), std::memory_order_release);
+
+    // As in the mpsc push: `Base::pop` is bypassed, so wake the (single) producer
+    // that may be blocked or suspended on fullness.
+    this->wake_producer();
+    return true;
+  }
+
+  /** As with the mpsc push_range, slots are claimed individually. */
+  template<typename Iterator>
+  std::size_t pop_range(Iterator first, Iterator last) noexcept
+  {
+    auto count = std::size_t { 0 };
+    for (; first != last; ++first, ++count)
+    { if (! pop(*first)) break; }
+
+    return count;
+  }
+
+protected:
+  static constexpr auto concurrency_ = concurrency_policy::spmc;
+
+  alignas(cache_line_size) std::atomic<std::size_t> read_reserve_ { 0 };
+
+private:
+  // The mirror of the mpsc restriction: every single-consumer consumer-side idiom
+  // advances `read_index_` without touching `read_reserve_`, desynchronizing the two
+  // and livelocking the next pop, so the whole family is hidden in this
+  // configuration. (`clear()` builds on `front()`/`consume()` and is rejected with
+  // them.)
+  using Base::front;
+  using Base::consume;
+  using Base::peek;
+  using Base::begin;
+  using Base::end;
+  using Base::consume_up_to;
+  using Base::consume_all;
+  using Base::readable_span;
+  using Base::release;
+};
+
+
+template<typename Base, enum data_write_policy>
+class data_write_policy_t;
+
+
+template<typename Base>
+class data_write_policy_t<Base, data_write_policy::overwrite> : public Base
+{
+public:
+
+  // Vacating the oldest slot races an in-flight `pop` of that same slot: the consumer
+  // reads the element before publishing its new read index, so a successful producer
+  // CAS does not prove the consumer is done with the slot, only that it had not yet
+  // claimed it. The consumer may therefore read a slot the producer is concurrently
+  // rewriting and come away with a torn (mixed old/new) element, and any non-trivial
+  // destructor could run against that half-written state. Torn reads of trivially
+  // copyable values are merely stale data, never UB — the same bargain the deque and
+  // the overwriting multicast ring strike — so that is what we require here.
+  static_assert(std::is_trivially_copyable_v<typename Base::type>,
+                "overwriting a full queue races in-flight pops of the vacated slot, "
+                "so the element type must be trivially copyable");
+
+  /**
+   *  When the queue is full, the oldest element is overwritten.
+   *
+   *  While the queue has space this is exactly the wait-free `Base::push` — no RMW
+   *  traffic on the read index and no unconsumed element is ever dropped. Only when
+   *  the queue is genuinely full does the producer advance `read_index_` (with a CAS,
+   *  since the consumer may release a slot concurrently) to vacate the oldest element
+   *  and retry. A pop racing the vacate may observe a torn element (see the class
+   *  comment); it is never dropped *and* delivered, only one of the two.
+   */
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    static_assert(std::is_convertible_v<std::remove_cvref_t<U>, typename Base::type>);
+
+    // `Base::push` consumes `elem` only on success, so forwarding in a loop is safe.
+    while (! Base::push(std::forward<U>(elem)))
+    {
+      auto old_read_index = this->read_index_.load(Base::order_acquire_);
+      auto new_read_index = Base::next_index(old_read_index);
+
+      // A failed CAS means the consumer freed a slot in the meantime — either way
+      // there is now room, and the retry above will claim it.
+      if (this->read_index_.compare_exchange_strong(old_read_index, new_read_index))
+      { this->destroy(old_read_index); }
+    }
+
+    // Although this method never fails, we return true to be consistent with the API
+    return true;
+  }
+
+  /**
+   *  The overwrite policy cannot use the bulk `Base::push_range` (a batch that does
+   *  not fit must advance the read index as it goes), so it pushes element-wise and
+   *  always consumes the whole range.
+   */
+  template<typename Iterator>
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    auto count = std::size_t { 0 };
+    for (; first != last; ++first, ++count)
+    { push(*first); }
+
+    return count;
+  }
+};
+
+
+template<typename Base>
+class data_write_policy_t<Base, data_write_policy::no_overwrite> : public Base
+{
+public:
+  template<typename U>
+  bool push(U && elem) noexcept
+  {
+    return Base::push( std::forward<U>(elem) );
+  }
+};
+
+/****************************************************************************************\
+  Instrumentation Policies
+\****************************************************************************************/
+
+template<typename Base, instrumentation instr>
+class instrumentation_policy_t;
+
+
+// Selecting no instrumentation must cost nothing: this layer is empty, so the chain
+// collapses to exactly the uninstrumented queue.
+template<typename Base>
+class instrumentation_policy_t<Base, instrumentation::none> : public Base
+{
+};
+
+/****************************************************************************************\
+  Core Policy-Chain Aliases
+
+  Inheritance Order:
+
+  `queue --> instrumentation_policy_t --> data_write_policy_t --> concurrency_policy_t
+   --> queue__base`
+
+  where each layer depends on the behaviours of those below it: the concurrency policy
+  may replace one side's push/pop with a multi-thread-safe variant, the data write
+  policy determines the behaviour of push when the queue is full, the instrumentation
+  policy (outermost, so it observes whichever push/pop the layers below select) is
+  empty unless instrumentation is requested, and `queue` provides the public
+  conveniences. This configuration permits us to avoid using `virtual`.
+
+  `queue.hpp` wraps these chains in `queue_wait_t` (see `queue_detail.hpp`) to add
+  the timed and blocking operations.
+\****************************************************************************************/
+
+template<typename type, std::size_t size,
+         memory_model model = memory_model::acquire_release,
+         concurrency_policy concurrency = concurrency_policy::spsc,
+         instrumentation instr = instrumentation::none>
+using queue_core__overwrite_policy_t  =
+  class queue<type, size,
+              instrumentation_policy_t<
+                data_write_policy_t<concurrency_policy_t<queue__base<type, size, model>, concurrency>,
+                                    data_write_policy::overwrite>,
+                instr>>;
+
+template<typename type, std::size_t size,
+         memory_model model = memory_model::acquire_release,
+         concurrency_policy concurrency = concurrency_policy::spsc,
+         instrumentation instr = instrumentation::none>
+using queue_core__no_overwrite_policy_t =
+  class queue<type, size,
+              instrumentation_policy_t<
+                data_write_policy_t<concurrency_policy_t<queue__base<type, size, model>, concurrency>,
+                                    data_write_policy::no_overwrite>,
+                instr>>;
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_QUEUE_CORE_DETAIL_HPP
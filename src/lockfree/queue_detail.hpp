@@ -10,208 +10,37 @@
 #ifndef LOCKFREE_QUEUE_DETAIL_HPP
 #define LOCKFREE_QUEUE_DETAIL_HPP
 
-#include <atomic>
-#include <array>
-#include <cstddef>
 #include <chrono>
-#include <future>
-#include <initializer_list>
-#include <iostream>
-#include <optional>
-#include <thread>
-#include <type_traits>
 
-#include "../type_traits.hpp"
+#include "queue_core_detail.hpp"
+#include "backoff.hpp"
+#include "instrument.hpp"
 
 /****************************************************************************************\
 
-  Classes in this file combine to facilitate all the required functionality of the
-  lock-free queue interface provided in `queue.hpp`. The use of `virual` has intentionally
-  been avoided to reduce runtime overhead. The queue relies entirely on stack allocations
-  so as to avoid heap allocations as well.
+  The extension layer over `queue_core_detail.hpp`: the timed and blocking `_wait`
+  operation families (which need `<chrono>` and the backoff policies), the coroutine
+  awaitables where the compiler supports them, and the opt-in instrumentation
+  policies (which need the histogram machinery). `queue.hpp` composes
+  these over the core chain so that its interface is unchanged; TUs that include only
+  `queue_core.hpp` never parse any of this.
 
 \****************************************************************************************/
 
 namespace lockfree::detail {
 
-template<typename data_type, std::size_t queue_size>
-struct queue__base
-{
-public:
-  static_assert(std::is_nothrow_default_constructible_v<data_type>);
-  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
-                std::is_nothrow_move_constructible_v<data_type>);
-
-  using type = data_type; // simplifies implementation of data_write_policy_t
-
-  template<typename U> // default behaviour is no-overwrite policy
-  bool push(U && elem) noexcept
-  {
-    static_assert(std::is_convertible_v<std::remove_reference_t<U>, data_type>);
-
-    auto old_write_index = write_index_.load();
-    auto new_write_index = next_index(old_write_index);
-
-    if (new_write_index == read_index_.load())
-    { return false; } // the queue is full
-
-    buffer_[old_write_index] = std::forward<U>(elem);
-    write_index_.store(new_write_index);
-    return true;
-  }
-
-  template<typename U>
-  bool pop(U & elem) noexcept
-  {
-    static_assert(std::is_convertible_v<data_type, U>);
-
-    auto old_read_index = read_index_.load();
-    auto new_read_index = next_index(old_read_index);
-
-    if (old_read_index == write_index_.load())
-    { return false; } // queue is empty
-
-    read_index_.store(new_read_index);
-    elem = std::move(buffer_[old_read_index]);
-    return true;
-  }
-
-protected:
-  static constexpr auto next_index(std::size_t index) noexcept -> std::size_t
-  { return ++index == buffer_size_ ? 0 : index; }
-
-  static constexpr auto buffer_size_ = queue_size + 1;
-  std::array<data_type, buffer_size_> buffer_ { };
-  std::atomic<std::size_t> read_index_  { 0 }, write_index_ { 0 };
-};
-
-/** A lockfree SPSC queue implementation
- *
- * Provides thread-safe push and pop operations when used in an SPSC
- * (single-producer-single-consumer) configuration.
- *
- * The queue is implemented using a ring-buffer that is a statically allocated to be of
- * size `queue_size+1`, which provides a convenient means of deterimining the buffer's
- * empty and full states:
+/** Adds the timed and blocking wait families on top of a core queue
  *
- * `queue_is_full &nbsp;<-- read_index+1 == write_index`<br>
- * `queue_is_empty <-- read_index &nbsp;&nbsp;== write_index`
- *
- * Requires:
- * - `data_type` is no-throw default constructible
- * - `data_type` is no-throw copy constructible
- * - `data_type` is no-throw move constructible
- *
- * Note:
- * - Not all methods are thread-safe. Methods that are not thread-safe are documented as
- * such.
- *
- * Sources that helped me:
- * - Timur Doumler - C++ in the Audio Industry talks [CppCon, Juce]
- * - Anthony Williams - C++ Concurrency in Action [Manning]
- *
- * @tparam data_type The queue's internal storage type
- * @tparam queue_size The maximum number of elements that the queue can hold at any time
- * @tparam data_write_policy The policy governing the behaviour of push operations (except
- *   for those having the suffix `_wait`) when the queue is full
+ * `Base` is a fully-composed `detail::queue` chain; every method here is a retry
+ * wrapper around `Base::push`/`Base::pop`, so whatever push/pop behaviour the chain's
+ * policies select is what gets retried.
  */
-template<typename data_type, std::size_t queue_size, typename Policy>
-class queue : public Policy
+template<typename Base>
+class queue_wait_t : public Base
 {
 public:
-  static_assert(std::is_nothrow_default_constructible_v<data_type>);
-  static_assert(std::is_nothrow_copy_constructible_v<data_type> ||
-                std::is_nothrow_move_constructible_v<data_type>);
-
-/****************************************************************************************\
-  Object lifetime
-\****************************************************************************************/
-
-  /** The default constructor */
-  queue() noexcept = default;
 
-  /** Initializer list constructor
-   *
-   * Enables static initialization of the queue with up to `queue_size` elements provided
-   * by an initializer list.
-   *
-   * @param[in] list An initializer list containing elements of type `data_type` to push
-   *   to the queue
-   */
-  queue(std::initializer_list<data_type> list) noexcept
-  {
-    push_range(std::begin(list), std::end(list));
-  }
-
-/****************************************************************************************\
-  Queue operations
-\****************************************************************************************/
-
-  /** Checks whether the queue is empty
-   *
-   * Returns a `bool` denoting whether the queue is empty or not.
-   *
-   * @returns `true if the queue is empty, `false` otherwise
-   * @note not thread-safe
-   */
-  bool empty() const noexcept
-  {
-    return this->read_index_.load() == this->write_index_.load();
-  }
-
-  /** Checks whether the queue is full
-   *
-   * Returns a `bool` denoting whether the queue is full or not.
-   *
-   * @returns `true` if the queue is full, `false` otherwise
-   */
-  bool full() const noexcept
-  {
-    return this->next_index(this->write_index_.load()) == this->read_index_.load();
-  }
-
-  /** Returns the number of enqueued elements
-   *
-   * @note This operation is not thread-safe.
-   *
-   * @returns The number of elements in the queue
-   */
-  std::size_t size() const noexcept
-  {
-    return static_cast<std::size_t>(
-      (this->buffer_size_ - this->read_index_.load() + this->write_index_.load()) % this->buffer_size_
-    );
-  }
-
-  /** Discards the enqueued elements.
-   *  @post The queue is empty.
-   */
-  void clear() noexcept
-  {
-    auto read_index = this->read_index_.load();
-    // we use `atomic_compare_exchange_weak` because we don't care about spurious false
-    // negatives, we're just going to loop anyway until the read_index it updated.
-    while (! this->read_index_.compare_exchange_weak(read_index, this->write_index_.load()) );
-  }
-
-  /** Pushes an element to the queue
-   *
-   * Attempts to push an element to the queue, returning `true` when successful,
-   * otherwise `false`. The exact behaviour depends upon the queue's `data_write_policy`.
-   * Where the policy is set to `no_overwrite` (default), and the queue is full, the
-   * operation will fail, and `false` is returned. Where the the policy is set to
-   * `overwrite` the operation will never fail, simply writing over the next value when
-   * space is needed.
-   *
-   * @tparam U Either `data_type` or a type that is convertible to `data_type`
-   * @param[in] elem The data element to be placed on the queue
-   * @returns `true` if the operation was successfull, `false` otherwise
-   */
-  template<typename U>
-  bool push(U && elem) noexcept
-  {
-    return Policy::push( std::forward<U>(elem) );
-  }
+  using Base::Base; // inherit the core constructors
 
   /** Pushes an element to the queue, retrying until successful
    *
@@ -221,13 +50,17 @@ public:
    * full prior to pushing, and/or it was instantiated with the `overwrite` policy.
    * given as the third template parameter.
    *
+   * @tparam backoff_policy The backoff applied after each failed attempt (see
+   *   `lockfree::backoff`); the default preserves pure spinning
    * @tparam U Either `data_type` or a type that is convertible to `data_type`
    * @param[in] elem The data element to be placed on the queue
    */
-  template<typename U>
+  template<typename backoff_policy = backoff::spin, typename U>
   void push_wait(U && elem) noexcept
   {
-    while (! Policy::push(std::forward<U>(elem)) );
+    auto backoff = backoff_policy { };
+    while (! Base::push(std::forward<U>(elem)) )
+    { backoff(); }
   }
 
   /** Adds an element to the queue, attempting `num_tries` times before failing
@@ -240,11 +73,15 @@ public:
    * @param[in] num_tries The maximum number of attempts to be made before returning
    * @returns `true` if the operation was successfull, `false` otherwise
    */
-  template<typename U>
+  template<typename backoff_policy = backoff::spin, typename U>
   bool push_wait_for(U && elem, int num_tries) noexcept
   {
+    auto backoff = backoff_policy { };
     for (auto i = 0; i<num_tries; ++i)
-    { if (Policy::push( std::forward<U>(elem) )) return true; }
+    {
+      if (Base::push( std::forward<U>(elem) )) return true;
+      backoff();
+    }
 
     return false;
   }
@@ -254,7 +91,9 @@ public:
    * As with the `push_wait_for(U&&, int)` overload, this method is guaranteed to
    * eventyually return. Successive attempts to push to the queue are made until either
    * the operation is successful, or the time duration specified by `timeout` has fully
-   * elapsed.
+   * elapsed. The wait is an in-thread spin against a `steady_clock` deadline — no
+   * thread is spawned — and the (comparatively expensive) clock is consulted only once
+   * per batch of failed attempts.
    *
    * @tparam U Either `data_type` or a type that is convertible to `data_type`
    * @tparam Rep A type representing the number of ticks (see STL documentation)
@@ -263,52 +102,23 @@ public:
    * @param[in] timeout The max time to wait before returning
    * @returns `true` if the operation was successfull, `false` otherwise
    */
-  template<typename U, typename Rep, typename Period>
+  template<typename backoff_policy = backoff::spin, typename U, typename Rep, typename Period>
   bool push_wait_for(U && elem, std::chrono::duration<Rep, Period> const& timeout) noexcept
   {
-    auto fut = std::async([this] () {
-      auto elem = data_type (/* default construct data_type */);
-      push_wait(std::forward<U>(elem));
-      return elem;
-    });
-
-    auto res = fut.wait_for(timeout);
-
-    if (res == std::future_status::timeout)
-    { return false; }
-
-    elem = fut.get();
-
-    return true;
-  }
-
-  /** Attempts to push a range of elements to the queue
-   *
-   * Attempts to push all the elements of the given range. If the queue fills up before
-   * the entire range is pushed, then subsequent attempts to push new elements are
-   * dependent on the queue's data write policy. If the `no_overwrite` policy has been
-   * specified, then the operation stops. Otherwise, with each successive push the oldest
-   * element will be overwritten until the operation completes.
-   *
-   * @tparam Iterator Any type that supports the features of an input iterator and which
-   *   dereferences to an element of type `data_type`
-   * @param[in] first An iterator marking the first element of the range to push
-   * @param[in] last An iterator that abuts the last element of the range
-   * @returns The number of elements that were pushed
-   */
-  template<typename Iterator>
-  int push_range(Iterator first, Iterator last) noexcept
-  {
-    static_assert(std::is_nothrow_constructible_v<data_type, decltype(*first)>);
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    auto backoff = backoff_policy { };
 
-    int count = 0;
-    while((first+count) != last)
+    for (;;)
     {
-      if(! Policy::push(*(first+count))) break;
-      ++count;
+      for (auto i = 0; i < clock_check_cadence_; ++i)
+      {
+        if (Base::push( std::forward<U>(elem) )) return true;
+        backoff();
+      }
+
+      if (std::chrono::steady_clock::now() >= deadline)
+      { return false; }
     }
-
-    return count;
   }
 
   /** Attempts to push a range of elements to the queue
@@ -321,45 +131,18 @@ public:
    *  @param[in] first An iterator marking the first element of the range to push
    *  @param[in] last An iterator demarking one element past the end of the range
    */
-  template<typename Iterator>
+  template<typename backoff_policy = backoff::spin, typename Iterator>
   void push_range_wait(Iterator first, Iterator last) noexcept
   {
-    static_assert(std::is_nothrow_constructible_v<data_type, decltype(*first)>);
+    static_assert(std::is_nothrow_constructible_v<typename Base::type, decltype(*first)>);
 
     while(first != last)
     {
-      push_wait(*first);
+      push_wait<backoff_policy>(*first);
       ++first;
     }
   }
 
-  /** Pops an element from the queue
-   *
-   * Removes the next element from the queue, assigning it to a given reference. When the
-   * queue contains one or more elements the operation will complete successfully it will
-   * save the popped value to the given reference and return `true`, otherwise it will
-   * simply return `false`.
-   *
-   * @tparam U Either `data_type` or a type that is assignable from `data_type`
-   * @param[out] elem The location to which the popped element will be assigned
-   * @returns `true` if the pop was successful, `false` otherwise
-   */
-  template<typename U>
-  bool pop(U & elem) noexcept
-  {
-    return Policy::pop(elem);
-  }
-
-  /** Convenience wrapper for queue::pop(data_type&)
-   *
-   *  @returns optional containing element if pop was successfull, std::nullopt otherwise
-   */
-  std::optional<data_type> pop() noexcept
-  {
-    auto elem = data_type (/* default construct data_type */);
-    return Policy::pop(elem) ? std::optional<data_type> { std::move(elem) } : std::nullopt;
-  }
-
   /** Pops an element from queue, retrying until successfull
    *
    * This method's runtime is unbounded, and will not return so long as the queue is
@@ -367,14 +150,17 @@ public:
    * indefinitely. If it cannot be guaranteed that the queue is not empty, or will not
    * remain empty indefinitely, either versio of `pop_wait_for` should be called instead.
    *
+   * @tparam backoff_policy The backoff applied after each failed attempt (see
+   *   `lockfree::backoff`); the default preserves pure spinning
    * @tparam U Either `data_type` or a type that is assignable from `data_type`
    * @param[out] elem The location to which the popped element will be assigned
    */
-  template<typename U>
+  template<typename backoff_policy = backoff::spin, typename U>
   void pop_wait(U & elem) noexcept
   {
-    // static_assert(std::is_nothrow_constructible_v<std::remove_reference_t<U>, data_type>);
-    while (! Policy::pop(elem) );
+    auto backoff = backoff_policy { };
+    while (! Base::pop(elem) )
+    { backoff(); }
   }
 
   /** Pops an element from the queue, retrying until successful
@@ -384,10 +170,11 @@ public:
    *
    * @returns The next element from the queue when the queue is not empty
    */
-  data_type pop_wait() noexcept
+  template<typename backoff_policy = backoff::spin>
+  typename Base::type pop_wait() noexcept
   {
-    auto elem = data_type (/* default construct data_type */);
-    pop_wait(elem);
+    auto elem = typename Base::type (/* default construct data_type */);
+    pop_wait<backoff_policy>(elem);
     return elem;
   }
 
@@ -401,10 +188,15 @@ public:
    * @param num_tries The maximum number of attempts to make before returning
    * @returns `true` if the pop was successful, `false` otherwise
    */
-  bool pop_wait_for(data_type & elem, int num_tries) noexcept
+  template<typename backoff_policy = backoff::spin>
+  bool pop_wait_for(typename Base::type & elem, int num_tries) noexcept
   {
+    auto backoff = backoff_policy { };
     for (auto i = 0; i<num_tries; ++i)
-    { if (Policy::pop(elem)) return true; }
+    {
+      if (Base::pop(elem)) return true;
+      backoff();
+    }
 
     return false;
   }
@@ -413,7 +205,9 @@ public:
    *
    * As with `pop_wait_for(U&&, int)`, this method is guaranteed to eventyually return.
    * Successive attempts to pop from the queue are made until either the operation is
-   * successful, or the time duration specified by `timeout` has fully elapsed.
+   * successful, or the time duration specified by `timeout` has fully elapsed. As with
+   * `push_wait_for`, the wait is an in-thread spin against a `steady_clock` deadline
+   * with the clock consulted only once per batch of failed attempts.
    *
    * @tparam U Either `data_type` or a type that is assignable from `data_type`
    * @tparam Rep A type representing the number of ticks (see STL documentation)
@@ -422,49 +216,23 @@ public:
    * @param[in] timeout The max time to wait before returning
    * @returns `true` if the operation was successful, `false` otherwise
    */
-  template<typename U, typename Rep, typename Period>
+  template<typename backoff_policy = backoff::spin, typename U, typename Rep, typename Period>
   bool pop_wait_for(U & elem, std::chrono::duration<Rep, Period> const& timeout) noexcept
   {
-    auto fut = std::async([this] () {
-      auto elem = data_type (/* default construct data_type */);
-      pop_wait(elem);
-      return elem;
-    });
-
-    auto res = fut.wait_for(timeout);
-
-    if (res == std::future_status::timeout)
-    { return false; }
-
-    elem = fut.get();
-
-    return true;
-  }
-
-  /** Attempts to pops a range of elements from the queue
-   *
-   * Attempts to fill all the elements of a given range. If the queue empties before the
-   * entire range is filled, then the method returns.
-   *
-   * @tparam Iterator Any type that meets the requirements for an input iterator and
-   *   whose dereferenced type can be assigned by by an element of type `data_type`.
-   * @param[out] first An iterator marking the first elementof the range to assign
-   *   popped elements to
-   * @param[out] last An iterator that abuts the last element of the range
-   */
-  template<typename Iterator>
-  int pop_range(Iterator first, Iterator last) noexcept
-  {
-    static_assert(std::is_nothrow_assignable_v<decltype(*first), data_type>);
+    auto const deadline = std::chrono::steady_clock::now() + timeout;
+    auto backoff = backoff_policy { };
 
-    int count = 0;
-    while((first+count) != last)
+    for (;;)
     {
-      if(! Policy::pop(*(first+count))) break;
-      ++count;
+      for (auto i = 0; i < clock_check_cadence_; ++i)
+      {
+        if (Base::pop(elem)) return true;
+        backoff();
+      }
+
+      if (std::chrono::steady_clock::now() >= deadline)
+      { return false; }
     }
-
-    return count;
   }
 
   /** Attempts to pop a range of elements from the queue
@@ -477,111 +245,475 @@ public:
    *   the sequence of popped elements to
    * @param[out] last An iterator demarking one element past the end of the range
    */
-  template<typename Iterator>
+  template<typename backoff_policy = backoff::spin, typename Iterator>
   void pop_range_wait(Iterator first, Iterator last) noexcept
   {
-    static_assert(std::is_nothrow_assignable_v<decltype(*first), data_type>);
+    static_assert(std::is_nothrow_assignable_v<decltype(*first), typename Base::type>);
 
     while(first != last)
     {
-      pop_wait(*first);
+      pop_wait<backoff_policy>(*first);
       ++first;
     }
   }
 
-  /** Pops an element from the queue then applies a given function to it
+#if defined(__cpp_lib_atomic_wait)
+
+  /** Pushes an element to the queue, parking the thread while the queue is full
+   *
+   * The opt-in blocking counterpart of `push_wait`: after a brief spin the producer
+   * registers itself and parks on a C++20 atomic wait (a futex on Linux) against
+   * `read_index_`, to be woken by the consumer when a slot frees up. Use this on
+   * low-rate queues where `push_wait` would burn a core idling.
+   *
+   * @tparam U Either `data_type` or a type that is convertible to `data_type`
+   * @param[in] elem The data element to be placed on the queue
+   */
+  template<typename U>
+  void push_wait_blocking(U && elem) noexcept
+  {
+    // There is a single producer waiter flag, so only one producer may ever park
+    static_assert(Base::concurrency_ != concurrency_policy::mpsc,
+                  "push_wait_blocking requires a single producer");
+
+    for (;;)
+    {
+      for (auto i = 0; i < spins_before_park_; ++i)
+      {
+        if (Base::push( std::forward<U>(elem) )) return;
+        backoff::cpu_relax();
+      }
+
+      auto read_index = this->read_index_.load();
+      this->producer_waiting_.store(true, std::memory_order_seq_cst);
+
+      // Recheck after raising the flag: a slot freed in between means the consumer
+      // may not have seen the flag, so we must not park.
+      if (Base::push( std::forward<U>(elem) ))
+      {
+        this->producer_waiting_.store(false, std::memory_order_relaxed);
+        return;
+      }
+
+      this->read_index_.wait(read_index);
+    }
+  }
+
+  /** Pops an element from the queue, parking the thread while the queue is empty
    *
-   * The provided function may optionally be called with a list of arguments that are
-   * supplied to it following the popped element.
+   * The opt-in blocking counterpart of `pop_wait`; see `push_wait_blocking`. The
+   * thread parks on `write_index_` and is woken by the producer publishing into an
+   * empty queue.
    *
-   * @tparam Fn Function's type
-   * @tparam Args The sequence of function argument types, less `data_type`
-   * @param fn The function to apply
-   * @param args The functions arguments
+   * @tparam U Either `data_type` or a type that is assignable from `data_type`
+   * @param[out] elem The location to which the popped element will be assigned
+   */
+  template<typename U>
+  void pop_wait_blocking(U & elem) noexcept
+  {
+    // There is a single consumer waiter flag, so only one consumer may ever park
+    static_assert(Base::concurrency_ != concurrency_policy::spmc,
+                  "pop_wait_blocking requires a single consumer");
+
+    for (;;)
+    {
+      for (auto i = 0; i < spins_before_park_; ++i)
+      {
+        if (Base::pop(elem)) return;
+        backoff::cpu_relax();
+      }
+
+      auto write_index = this->write_index_.load();
+      this->consumer_waiting_.store(true, std::memory_order_seq_cst);
+
+      if (Base::pop(elem))
+      {
+        this->consumer_waiting_.store(false, std::memory_order_relaxed);
+        return;
+      }
+
+      this->write_index_.wait(write_index);
+    }
+  }
+
+#endif // __cpp_lib_atomic_wait
+
+#if defined(__cpp_impl_coroutine)
+
+  /** The awaitable returned by `co_push`; completes immediately unless the queue is
+   *  full, in which case the coroutine suspends until the consumer frees a slot.
    */
-  template <typename Fn, typename... Args>
-  bool consume_with(Fn && fn, Args &&... args)
+  class push_awaitable
   {
-    auto elem = data_type (/* default construct data_type */);
-    if (Policy::pop(&elem))
+  public:
+
+    push_awaitable(queue_wait_t & queue, typename Base::type elem) noexcept
+    : queue_ { queue }, elem_ { std::move(elem) }
     {
-      std::invoke(std::forward<Fn>(fn), std::move(elem), std::forward<Args>(args)...);
+    }
+
+    // The fast path: `push` consumes the element only on success, so a full queue
+    // leaves it intact for the retry in `await_resume`.
+    bool await_ready() noexcept
+    { return pushed_ = queue_.push(std::move(elem_)); }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+      // Once the handle is published the consumer may resume (and even finish) the
+      // coroutine, so the frame — including this awaitable — must not be touched
+      // again; everything needed afterwards lives on the stack.
+      auto & queue = queue_;
+      queue.parked_producer_.store(handle.address(), std::memory_order_seq_cst);
+
+      // Recheck after parking: a pop that slipped in just beforehand may have missed
+      // the handle. If the queue is no longer full, reclaim the handle and resume at
+      // once — unless the consumer already claimed it, in which case it will resume
+      // this coroutine itself.
+      if (! queue.full())
+      { return queue.parked_producer_.exchange(nullptr, std::memory_order_seq_cst) != handle.address(); }
+
       return true;
     }
 
-    return false;
+    void await_resume() noexcept
+    {
+      // Resumed by the consumer freeing a slot — and only this producer fills it.
+      if (! pushed_) { queue_.push(std::move(elem_)); }
+    }
+
+  private:
+    queue_wait_t &            queue_;
+    typename Base::type       elem_;
+    bool                      pushed_ { false };
+  };
+
+  /** The awaitable returned by `co_pop`; completes immediately unless the queue is
+   *  empty, in which case the coroutine suspends until the producer publishes.
+   */
+  class pop_awaitable
+  {
+  public:
+
+    explicit pop_awaitable(queue_wait_t & queue) noexcept
+    : queue_ { queue }
+    {
+    }
+
+    bool await_ready() noexcept
+    {
+      elem_ = queue_.pop();
+      return elem_.has_value();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+      auto & queue = queue_; // as in push_awaitable: no frame access past the store
+      queue.parked_consumer_.store(handle.address(), std::memory_order_seq_cst);
+
+      if (! queue.empty())
+      { return queue.parked_consumer_.exchange(nullptr, std::memory_order_seq_cst) != handle.address(); }
+
+      return true;
+    }
+
+    typename Base::type await_resume() noexcept
+    {
+      // Resumed by the producer publishing into the empty queue — and only this
+      // consumer pops, so the element is still there.
+      if (! elem_) { elem_ = queue_.pop(); }
+      return *std::move(elem_);
+    }
+
+  private:
+    queue_wait_t &                     queue_;
+    std::optional<typename Base::type> elem_;
+  };
+
+  /** Pushes an element to the queue, suspending the awaiting coroutine while full
+   *
+   * The coroutine counterpart of `push_wait_blocking`: the fast path completes
+   * without suspending, and a coroutine parked on a full queue is resumed by the pop
+   * that frees a slot — no polling timer and no burnt core in between.
+   *
+   * @note The resumption runs inline on the consumer's thread; schedule onto an
+   *   executor inside the coroutine if that is not acceptable. At most one `co_push`
+   *   may be in flight, per the single-producer contract.
+   */
+  template<typename U>
+  push_awaitable co_push(U && elem) noexcept
+  {
+    // There is a single parked-producer handle, so only one producer may suspend
+    static_assert(Base::concurrency_ != concurrency_policy::mpsc,
+                  "co_push requires a single producer");
+
+    return push_awaitable { *this, std::forward<U>(elem) };
+  }
+
+  /** Pops an element from the queue, suspending the awaiting coroutine while empty
+   *
+   * The coroutine counterpart of `pop_wait_blocking`; see `co_push`. A coroutine
+   * parked on an empty queue is resumed by the push that publishes into it.
+   *
+   * @note The resumption runs inline on the producer's thread; at most one `co_pop`
+   *   may be in flight, per the single-consumer contract.
+   */
+  pop_awaitable co_pop() noexcept
+  {
+    // There is a single parked-consumer handle, so only one consumer may suspend
+    static_assert(Base::concurrency_ != concurrency_policy::spmc,
+                  "co_pop requires a single consumer");
+
+    return pop_awaitable { *this };
   }
 
-}; // class queue
+#endif // __cpp_impl_coroutine
 
+protected:
+  // How many failed push/pop attempts the `_wait_for` deadline loops make between
+  // clock checks; a clock read costs far more than a failed attempt.
+  static constexpr auto clock_check_cadence_ = 64;
 
-template<typename Base, enum data_write_policy>
-class data_write_policy_t;
+#if defined(__cpp_lib_atomic_wait)
+  // Parking costs a syscall both ways; most waits are short, so spin a little first.
+  static constexpr auto spins_before_park_ = 256;
+#endif
 
+}; // class queue_wait_t
 
+/****************************************************************************************\
+  Instrumentation Policy Specializations
+
+  The primary template and the empty `none` specialization live in the core header;
+  the active policies are defined here, beside the histogram machinery they need.
+\****************************************************************************************/
+
+/**
+ *  Timestamps every element on push and records its enqueue-to-dequeue latency on
+ *  pop into a `lockfree::latency_histogram` (see `instrument.hpp`).
+ *
+ *  Timestamps live in a parallel ring indexed by sequence number: push/pop are FIFO,
+ *  so the producer's n-th push is the consumer's n-th pop and each side needs only a
+ *  thread-local counter — no extra shared state, and the timestamp store is ordered
+ *  by the queue's own index publication. The `consume()` path records as well, which
+ *  keeps `clear()` and the front()/consume() idiom in sync with the timestamp ring.
+ *
+ *  Not instrumented: `emplace` and the reserve()/commit() producer idiom (elements
+ *  entering through them carry a stale slot timestamp, so prefer `push` on queues
+ *  with this policy), and the bulk `consume_all`/`consume_up_to` drains.
+ */
 template<typename Base>
-class data_write_policy_t<Base, data_write_policy::overwrite> : public Base
+class instrumentation_policy_t<Base, instrumentation::latency_histogram> : public Base
 {
 public:
 
-  /**
-   *  When the queue is full, the oldest element is overwritten.
-   *
-   *  Invariant:
-   *  - When the queue is full `write_index` is `n` and `read_index` is `n+1 % buffer_size`
-   *    where `read_index` is pointing to the oldest element about to be overwritten.
-   *
-   *  To overwrite the oldest element, `read_index` must be incremented to point the next
-   *  oldest element prior to writing the next element and incrementing `write_index`.
-   */
   template<typename U>
   bool push(U && elem) noexcept
   {
-    static_assert(std::is_convertible_v<std::remove_cvref_t<U>, typename Base::type>);
-
-    auto old_read_index = this->read_index_.load();
-    auto new_read_index = next_index(old_read_index);
-    // CAS because we are on the write thread
-    while(! this->read_index_.compare_exchange_weak(old_read_index, new_read_index) );
-    // The old read index is the new write index
-    this->buffer_[old_read_index] = std::forward<U>(elem);
-    this->write_index_.store(old_read_index);
-    // Although this method will never fail, we return true to be consisten with the API
+    // The timestamp must be in place before Base::push publishes the element: the
+    // consumer may pop it the instant the write index is released.
+    timestamps_[push_seq_ % timestamp_ring_size_].store(now(), std::memory_order_relaxed);
+
+    if (! Base::push(std::forward<U>(elem))) { return false; }
+
+    ++push_seq_;
     return true;
   }
-};
 
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    if (! Base::pop(elem)) { return false; }
+
+    record_latency();
+    return true;
+  }
+
+  void consume() noexcept
+  {
+    Base::consume();
+    record_latency();
+  }
+
+  // The bulk range paths cannot batch the per-element timestamps, so they degrade to
+  // element-wise operations under this policy.
+  template<typename Iterator>
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    auto count = std::size_t { 0 };
+    for (; first != last && push(*first); ++first, ++count) { }
+    return count;
+  }
+
+  template<typename Iterator>
+  std::size_t pop_range(Iterator first, Iterator last) noexcept
+  {
+    auto count = std::size_t { 0 };
+    for (; first != last && pop(*first); ++first, ++count) { }
+    return count;
+  }
+
+  /** Returns a percentile summary (p50/p99/p999/max) of the recorded latencies
+   *
+   * Safe to call from any thread, concurrently with push and pop.
+   */
+  latency_snapshot latency() const noexcept
+  {
+    return histogram_.snapshot();
+  }
+
+private:
+
+  using clock_type     = std::chrono::steady_clock;
+  using timestamp_type = std::chrono::nanoseconds::rep;
+
+  static timestamp_type now() noexcept
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             clock_type::now().time_since_epoch()).count();
+  }
+
+  void record_latency() noexcept
+  {
+    auto const then = timestamps_[pop_seq_ % timestamp_ring_size_].load(std::memory_order_relaxed);
+    ++pop_seq_;
+    histogram_.record(std::chrono::nanoseconds { now() - then });
+  }
 
+  // The ring holds one slot more than the queue can hold in flight: the timestamp is
+  // written before the push is attempted, so a push that fails against a full queue
+  // stamps the slot *after* the newest in-flight element instead of stomping the
+  // oldest one's. (Stamping after a successful push is not an option — the consumer
+  // could pop the element before the timestamp lands.)
+  static constexpr std::size_t timestamp_ring_size_ = Base::buffer_size_ + 1;
+
+  latency_histogram histogram_;
+  alignas(cache_line_size) std::size_t push_seq_ { 0 }; // producer-owned
+  alignas(cache_line_size) std::size_t pop_seq_  { 0 }; // consumer-owned
+  std::array<std::atomic<timestamp_type>, timestamp_ring_size_> timestamps_ { };
+};
+
+/**
+ *  Maintains per-side relaxed counters for push/pop outcomes and a high-water
+ *  occupancy mark, summarized by `stats()` (see `queue_statistics` in
+ *  `instrument.hpp`).
+ *
+ *  Each counter lives on — and is only ever written by — the side that already owns
+ *  the cache line it shares, so the hot-path cost is a relaxed increment on
+ *  already-hot data. The high-water mark is the occupancy as the producer observes
+ *  it after each successful push; a stale read-index cache can only understate it.
+ *  Batch operations count each rejected element as a failure.
+ */
 template<typename Base>
-class data_write_policy_t<Base, data_write_policy::no_overwrite> : public Base
+class instrumentation_policy_t<Base, instrumentation::counters> : public Base
 {
 public:
+
   template<typename U>
   bool push(U && elem) noexcept
   {
-    return Base::push( std::forward<U>(elem) );
+    if (! Base::push(std::forward<U>(elem)))
+    {
+      push_failures_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    pushed_.fetch_add(1, std::memory_order_relaxed);
+    note_occupancy();
+    return true;
+  }
+
+  template<typename U>
+  bool pop(U & elem) noexcept
+  {
+    if (! Base::pop(elem))
+    {
+      pop_failures_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
   }
-};
 
-/****************************************************************************************\
-  Queue Partial Template Specializations
+  template<typename Iterator>
+  std::size_t push_range(Iterator first, Iterator last) noexcept
+  {
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const count     = Base::push_range(first, last);
 
-  Inheritance Order:
+    pushed_.fetch_add(count, std::memory_order_relaxed);
+    if (count < requested)
+    { push_failures_.fetch_add(requested - count, std::memory_order_relaxed); }
+    else
+    { note_occupancy(); }
 
-  `queue --> data_write_policy_t --> queue__base`
+    return count;
+  }
 
-  where both `queue` and `data_write_policy_t` depend on the behaviours of `queue__base`,
-  and `queue` further dependes on the policy-specific behaviours of `data_write_policy_y`.
-  This configuration permits us to avoid using `virtual`.
-\****************************************************************************************/
+  template<typename Iterator>
+  std::size_t pop_range(Iterator first, Iterator last) noexcept
+  {
+    auto const requested = static_cast<std::size_t>(std::distance(first, last));
+    auto const count     = Base::pop_range(first, last);
+
+    if (count < requested)
+    { pop_failures_.fetch_add(requested - count, std::memory_order_relaxed); }
+
+    return count;
+  }
+
+  /** Returns a snapshot of the counters; safe to call from any thread */
+  queue_statistics stats() const noexcept
+  {
+    return queue_statistics {
+      pushed_.load(std::memory_order_relaxed),
+      push_failures_.load(std::memory_order_relaxed),
+      pop_failures_.load(std::memory_order_relaxed),
+      high_water_.load(std::memory_order_relaxed),
+    };
+  }
+
+private:
 
-template<typename type, std::size_t size>
-using queue__overwrite_policy_t  =
-  class queue<type, size, data_write_policy_t<queue__base<type, size>, data_write_policy::overwrite>>;
+  void note_occupancy() noexcept
+  {
+    // Both of these lines are already hot on the producer: its own write index and
+    // its cached view of the read index. The cache lagging can only understate.
+    auto const occupied = Base::occupancy(this->read_index_cache_,
+                                          this->write_index_.load(Base::order_relaxed_));
+
+    // Producer-owned, so a plain (non-RMW) max update suffices
+    if (occupied > high_water_.load(std::memory_order_relaxed))
+    { high_water_.store(occupied, std::memory_order_relaxed); }
+  }
+
+  // producer-owned counters
+  alignas(cache_line_size) std::atomic<std::uint64_t> pushed_        { 0 };
+  std::atomic<std::uint64_t>                          push_failures_ { 0 };
+  std::atomic<std::size_t>                            high_water_    { 0 };
+
+  // consumer-owned counters
+  alignas(cache_line_size) std::atomic<std::uint64_t> pop_failures_  { 0 };
+};
+
+/****************************************************************************************\
+  Full Policy-Chain Aliases
+
+  The chains from `queue_core_detail.hpp` wrapped in `queue_wait_t`, giving the
+  complete interface that `queue.hpp` has always exposed.
+\****************************************************************************************/
 
-template<typename type, std::size_t size>
+template<typename type, std::size_t size,
+         memory_model model = memory_model::acquire_release,
+         concurrency_policy concurrency = concurrency_policy::spsc,
+         instrumentation instr = instrumentation::none>
+using queue__overwrite_policy_t =
+  queue_wait_t<queue_core__overwrite_policy_t<type, size, model, concurrency, instr>>;
+
+template<typename type, std::size_t size,
+         memory_model model = memory_model::acquire_release,
+         concurrency_policy concurrency = concurrency_policy::spsc,
+         instrumentation instr = instrumentation::none>
 using queue__no_overwrite_policy_t =
-  class queue<type, size, data_write_policy_t<queue__base<type, size>, data_write_policy::no_overwrite>>;
+  queue_wait_t<queue_core__no_overwrite_policy_t<type, size, model, concurrency, instr>>;
 
 } // namespace lockfree::detail
 
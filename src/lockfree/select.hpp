@@ -0,0 +1,36 @@
+/****************************************************************************************\
+  @file      select.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_SELECT_HPP
+#define LOCKFREE_SELECT_HPP
+
+#include "select_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::select
+ * @extends lockfree::detail::select
+ */
+template<typename queue_type, std::size_t set_size>
+class select : public detail::select<queue_type, set_size>
+{
+  using super = detail::select<queue_type, set_size>;
+
+public:
+  using super::super; // inherit superclass constructors;
+};
+
+// Deduce the set from the constructor arguments: `select s { q0, q1, q2 };`
+template<typename queue_type, typename... queue_types>
+select(queue_type &, queue_types &...) -> select<queue_type, 1 + sizeof...(queue_types)>;
+
+} // namespace lockfree
+
+#endif // LOCKFREE_SELECT_HPP
@@ -0,0 +1,138 @@
+/****************************************************************************************\
+  @file      select_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_SELECT_DETAIL_HPP
+#define LOCKFREE_SELECT_DETAIL_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "backoff.hpp"
+
+/****************************************************************************************\
+
+  A readiness tracker for fan-in consumers draining many SPSC queues. Probing an idle
+  queue is cheap — its index line sits unchanged in the probing core's cache — but a
+  hand-rolled round-robin loop still pays the probe (and the branch) for every idle
+  queue on every iteration. `select` amortizes that: a sweep fills a readiness bitmap
+  with one probe per queue, and subsequent polls service the set bits round-robin
+  without touching the idle queues at all, re-sweeping only when the bitmap runs dry.
+
+  Because the caller is necessarily the (sole) consumer of every registered queue,
+  readiness cannot be stolen: a queue reported ready stays ready until the caller
+  itself pops from it. Weighted servicing falls out of registration: a queue
+  registered k times gets k slots per rotation.
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename queue_type, std::size_t set_size>
+class select
+{
+public:
+
+  static_assert(set_size >= 1);
+  static_assert(set_size <= 64, "the readiness bitmap holds at most 64 queues");
+
+  /** Registers the queues to be drained; the caller must be the consumer of each */
+  template<typename... queue_types>
+  explicit select(queue_type & first, queue_types &... rest) noexcept
+  : queues_ { &first, &rest... }
+  {
+  }
+
+  /** Finds a ready (non-empty) queue, servicing fairly
+   *
+   * Set bits from the last sweep are serviced in rotation before any idle queue is
+   * probed again; a fresh sweep happens only when no queue is known to be ready.
+   *
+   * @returns The index of a non-empty queue, or `std::nullopt` when all are empty
+   * @note Consumer-thread only.
+   */
+  std::optional<std::size_t> poll() noexcept
+  {
+    if (ready_ == 0) { sweep(); }
+
+    while (ready_ != 0)
+    {
+      auto const index = next_ready_index();
+
+      if (! queues_[index]->empty())
+      {
+        cursor_ = index + 1 == set_size ? 0 : index + 1;
+        return index;
+      }
+
+      ready_ &= ~bit(index); // drained since the sweep that set it
+    }
+
+    return std::nullopt;
+  }
+
+  /** Polls until some queue becomes ready
+   *
+   * @tparam backoff_policy The backoff applied after each empty sweep (see
+   *   `lockfree::backoff`)
+   * @returns The index of a non-empty queue
+   * @note Unbounded runtime, like `pop_wait`. Consumer-thread only.
+   */
+  template<typename backoff_policy = backoff::spin>
+  std::size_t wait() noexcept
+  {
+    auto backoff = backoff_policy { };
+
+    for (;;)
+    {
+      if (auto index = poll()) { return *index; }
+      backoff();
+    }
+  }
+
+  /** The queue registered at `index` */
+  queue_type & operator[](std::size_t index) noexcept { return *queues_[index]; }
+
+  /** The number of registered queues */
+  static constexpr std::size_t size() noexcept { return set_size; }
+
+private:
+
+  static constexpr std::uint64_t bit(std::size_t index) noexcept
+  { return std::uint64_t { 1 } << index; }
+
+  /** One probe per queue; idle lines are cache-resident, so this is load-and-branch */
+  void sweep() noexcept
+  {
+    for (auto i = std::size_t { 0 }; i < set_size; ++i)
+    {
+      if (! queues_[i]->empty()) { ready_ |= bit(i); }
+    }
+  }
+
+  /** The first set bit at or after the rotation cursor (wrapping) */
+  std::size_t next_ready_index() const noexcept
+  {
+    auto const rotated = ready_ >> cursor_;
+    if (rotated != 0)
+    { return cursor_ + static_cast<std::size_t>(std::countr_zero(rotated)); }
+
+    return static_cast<std::size_t>(std::countr_zero(ready_));
+  }
+
+  std::array<queue_type *, set_size> queues_;
+  std::uint64_t ready_  { 0 };
+  std::size_t   cursor_ { 0 };
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_SELECT_DETAIL_HPP
@@ -0,0 +1,31 @@
+/****************************************************************************************\
+  @file      shm_queue.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_SHM_QUEUE_HPP
+#define LOCKFREE_SHM_QUEUE_HPP
+
+#include "shm_queue_detail.hpp"
+
+namespace lockfree {
+
+/**
+ * @copydoc lockfree::detail::shm_queue
+ * @extends lockfree::detail::shm_queue
+ *
+ * Deriving from the detail type (rather than aliasing it) would add a layer whose
+ * layout the `create`/`attach` factories do not name, so the interprocess queue is
+ * exposed as the detail type itself.
+ */
+template<typename data_type, std::size_t queue_size,
+         enum memory_model model = memory_model::acquire_release>
+using shm_queue = detail::shm_queue<data_type, queue_size, model>;
+
+} // namespace lockfree
+
+#endif // LOCKFREE_SHM_QUEUE_HPP
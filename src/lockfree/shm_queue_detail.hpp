@@ -0,0 +1,96 @@
+/****************************************************************************************\
+  @file      shm_queue_detail.hpp
+  @package   lockfree
+  @author    Tristan Bayfield
+  @date      2026-08-30
+
+  @copyright Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#ifndef LOCKFREE_SHM_QUEUE_DETAIL_HPP
+#define LOCKFREE_SHM_QUEUE_DETAIL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "queue_core.hpp"
+
+/****************************************************************************************\
+
+  The interprocess specialization of the queue. The SPSC ring is already a single
+  self-contained object — indices and buffer inline, no pointers, no heap — so placed
+  in a region that two processes map, it works across the process boundary exactly as
+  it does across threads, provided that:
+
+  - the element type carries no pointers (enforced: trivially copyable),
+  - the index atomics are address-free (enforced: `is_always_lock_free`, which on
+    every supported platform means plain atomic loads/stores — no hidden lock that
+    would be per-process), and
+  - both processes agree on the layout (enforced: standard layout; both sides must
+    be built with the same `data_type`, `queue_size`, and ABI).
+
+  The blocking `_wait` family is deliberately absent: C++20 atomic waits are not
+  specified to work across processes, so the shm queue exposes only the core API and
+  interprocess waiting is the caller's affair (spin, or an out-of-band eventfd).
+
+\****************************************************************************************/
+
+namespace lockfree::detail {
+
+template<typename data_type, std::size_t queue_size,
+         memory_model model = memory_model::acquire_release>
+class shm_queue
+: public lockfree::queue_core<data_type, queue_size, data_write_policy::no_overwrite,
+                              model, concurrency_policy::spsc>
+{
+public:
+
+  // A pointer is only meaningful in the process that produced it, and a non-trivial
+  // copy could allocate — either breaks the fixed-ABI contract.
+  static_assert(std::is_trivially_copyable_v<data_type>,
+                "shm_queue requires a trivially copyable data_type");
+
+  // An atomic that is not address-free would fall back to a (per-process) lock
+  static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                "shm_queue requires lock-free index atomics");
+
+  /** The size of the mapping required to hold the queue */
+  static constexpr std::size_t region_size() noexcept { return sizeof(shm_queue); }
+
+  /** The alignment the mapping must provide (satisfied by any page-aligned mmap) */
+  static constexpr std::size_t region_alignment() noexcept { return alignof(shm_queue); }
+
+  /** Placement-constructs an empty queue into a mapped region
+   *
+   * Exactly one process calls `create`, before any other touches the region; every
+   * other participant uses `attach`.
+   *
+   * @pre `region` points to at least `region_size()` bytes of shared mapping, aligned
+   *   to `region_alignment()`.
+   * @returns The queue living in the region
+   */
+  static shm_queue * create(void * region) noexcept
+  {
+    static_assert(std::is_standard_layout_v<shm_queue>,
+                  "the queue must have one fixed layout for all participants");
+
+    return ::new (region) shm_queue;
+  }
+
+  /** Obtains the queue previously `create`d in a mapped region
+   *
+   * @pre `create` has completed in some process, and this process maps the same
+   *   region (at any address — the queue holds no pointers).
+   * @returns The queue living in the region
+   */
+  static shm_queue * attach(void * region) noexcept
+  {
+    return std::launder(reinterpret_cast<shm_queue *>(region));
+  }
+};
+
+} // namespace lockfree::detail
+
+#endif // LOCKFREE_SHM_QUEUE_DETAIL_HPP
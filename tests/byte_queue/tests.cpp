@@ -0,0 +1,154 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/byte_queue
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <lockfree/byte_queue.hpp>
+
+#include "../common.hpp"
+
+using lockfree::byte_queue;
+
+constexpr std::size_t ring_size = 64;
+
+namespace {
+
+// Frame a length-prefixed message directly into ring memory
+bool send(byte_queue<ring_size> & q, std::string const& message)
+{
+  auto const length = static_cast<std::uint8_t>(message.size());
+
+  auto region = q.reserve(sizeof(length) + message.size());
+  if (region == nullptr) { return false; }
+
+  std::memcpy(region, &length, sizeof(length));
+  std::memcpy(region + sizeof(length), message.data(), message.size());
+  q.commit(sizeof(length) + message.size());
+  return true;
+}
+
+// Parse one message out of the readable block, if a whole one is present
+bool receive(byte_queue<ring_size> & q, std::string & message)
+{
+  auto const readable = q.peek();
+  if (readable.empty()) { return false; }
+
+  auto length = std::uint8_t { };
+  std::memcpy(&length, readable.data(), sizeof(length));
+
+  message.assign(reinterpret_cast<char const*>(readable.data()) + sizeof(length), length);
+  q.release(sizeof(length) + length);
+  return true;
+}
+
+} // namespace
+
+
+TEST_CASE("Byte queue serves contiguous variable-length reservations", "[byte_queue]")
+{
+  auto q = byte_queue<ring_size> { };
+  REQUIRE(q.empty());
+
+  REQUIRE(send(q, "hello"));
+  REQUIRE(send(q, "bip-buffer"));
+  REQUIRE(q.size() == 2 + 5 + 10);
+
+  auto message = std::string { };
+  REQUIRE(receive(q, message));
+  REQUIRE(message == "hello");
+  REQUIRE(receive(q, message));
+  REQUIRE(message == "bip-buffer");
+  REQUIRE(q.empty());
+}
+
+TEST_CASE("Byte queue rejects reservations that cannot be contiguous", "[byte_queue]")
+{
+  auto q = byte_queue<ring_size> { };
+
+  REQUIRE(q.reserve(ring_size) != nullptr);
+  q.commit(ring_size);
+
+  // Full: nothing fits until the consumer releases
+  REQUIRE(q.reserve(1) == nullptr);
+
+  q.release(q.peek().size());
+  REQUIRE(q.reserve(1) != nullptr);
+}
+
+TEST_CASE("Byte queue wraps a reservation past the watermark", "[byte_queue]")
+{
+  auto q = byte_queue<ring_size> { };
+
+  // Park the offsets near the end of the ring
+  for (auto i = 0; i < 3; ++i)
+  {
+    REQUIRE(q.reserve(20) != nullptr);
+    q.commit(20);
+    q.release(q.peek().size());
+  }
+
+  // Only 4 bytes remain in the tail, so this reservation must wrap to the front
+  auto region = q.reserve(16);
+  REQUIRE(region != nullptr);
+
+  auto const bytes = std::vector<std::byte>(16, std::byte { 0xAB });
+  std::copy(bytes.begin(), bytes.end(), region);
+  q.commit(16);
+
+  // The consumer sees the wrapped block, contiguous, with the dead tail skipped
+  auto readable = q.peek();
+  REQUIRE(readable.size() == 16);
+  REQUIRE(std::equal(readable.begin(), readable.end(), bytes.begin()));
+
+  q.release(readable.size());
+  REQUIRE(q.empty());
+}
+
+TEST_CASE("Byte queue commits may be shorter than their reservation", "[byte_queue]")
+{
+  auto q = byte_queue<ring_size> { };
+
+  REQUIRE(q.reserve(32) != nullptr);
+  q.commit(10); // e.g. serialization turned out smaller than the worst case
+
+  REQUIRE(q.size() == 10);
+  REQUIRE(q.peek().size() == 10);
+}
+
+TEST_CASE("Byte queue can be used safely in a multithreaded context", "[byte_queue, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto message_count = 10000;
+
+  auto q = byte_queue<ring_size> { };
+
+  auto producer = std::thread { [&q] {
+    for (auto i = 0; i < message_count; ++i)
+    {
+      // Variable-length payloads, each prefixed by its length
+      auto const message = std::to_string(i);
+      while (! send(q, message)) { }
+    }
+  } };
+
+  auto message = std::string { };
+  for (auto i = 0; i < message_count; ++i)
+  {
+    while (! receive(q, message)) { }
+    REQUIRE(message == std::to_string(i));
+  }
+
+  producer.join();
+  REQUIRE(q.empty());
+}
@@ -0,0 +1,152 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/deque
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <lockfree/deque.hpp>
+
+#include "../common.hpp"
+
+using data_type = int;
+constexpr std::size_t deque_size = 16;
+
+
+TEST_CASE("Deque survives popping and stealing while virgin", "[deque]")
+{
+  auto d = lockfree::deque<data_type, deque_size> { };
+
+  // A pop before any push must not reserve (and wrap) an index
+  auto elem = data_type { };
+  REQUIRE(! d.pop(elem));
+  REQUIRE(! d.steal(elem));
+  REQUIRE(d.empty());
+  REQUIRE(d.size() == 0);
+
+  // ... and the deque must still be fully usable afterwards
+  REQUIRE(d.push(1));
+  REQUIRE(d.size() == 1);
+  REQUIRE(d.pop(elem));
+  REQUIRE(elem == 1);
+  REQUIRE(d.empty());
+}
+
+TEST_CASE("Deque pops in LIFO order on the owner's end", "[deque]")
+{
+  auto d = lockfree::deque<data_type, deque_size> { };
+  REQUIRE(d.empty());
+
+  for (auto i = 1; i <= 5; ++i) { REQUIRE(d.push(i)); }
+  REQUIRE(d.size() == 5);
+
+  // The owner works newest-first, keeping the hot task cache-local
+  for (auto i = 5; i >= 1; --i)
+  {
+    auto const elem = d.pop();
+    REQUIRE(elem.has_value());
+    REQUIRE(*elem == i);
+  }
+
+  REQUIRE(! d.pop().has_value());
+}
+
+TEST_CASE("Deque steals in FIFO order from the thieves' end", "[deque]")
+{
+  auto d = lockfree::deque<data_type, deque_size> { };
+
+  for (auto i = 1; i <= 5; ++i) { REQUIRE(d.push(i)); }
+
+  // Thieves take the oldest task, the one the owner would reach last
+  for (auto i = 1; i <= 5; ++i)
+  {
+    auto const elem = d.steal();
+    REQUIRE(elem.has_value());
+    REQUIRE(*elem == i);
+  }
+
+  REQUIRE(! d.steal().has_value());
+}
+
+TEST_CASE("Deque push fails when full", "[deque]")
+{
+  auto d = lockfree::deque<data_type, deque_size> { };
+
+  for (auto i = 0; i < static_cast<int>(deque_size); ++i) { REQUIRE(d.push(i)); }
+
+  // Bounded: the owner is expected to run the task inline instead
+  REQUIRE(! d.push(42));
+
+  auto elem = data_type { };
+  REQUIRE(d.steal(elem));
+  REQUIRE(d.push(42));
+}
+
+TEST_CASE("Deque hands the last element to exactly one end", "[deque]")
+{
+  auto d = lockfree::deque<data_type, deque_size> { };
+
+  REQUIRE(d.push(1));
+
+  auto elem = data_type { };
+  REQUIRE(d.pop(elem));
+  REQUIRE(elem == 1);
+
+  REQUIRE(! d.steal(elem));
+  REQUIRE(! d.pop(elem));
+  REQUIRE(d.empty());
+}
+
+TEST_CASE("Deque can be used safely in a multithreaded context", "[deque, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto element_count = 10000;
+  constexpr auto thief_count = 2;
+
+  auto d = lockfree::deque<data_type, deque_size> { };
+  auto done = std::atomic<bool> { false };
+
+  auto thief_sums = std::array<long long, thief_count> { };
+  auto thieves = std::vector<std::thread> { };
+
+  for (auto t = 0; t < thief_count; ++t)
+  {
+    thieves.emplace_back([&d, &done, &sum = thief_sums[t]] {
+      auto elem = data_type { };
+      while (! (done.load() && d.empty()))
+      {
+        if (d.steal(elem)) { sum += elem; }
+      }
+    });
+  }
+
+  // The owner pushes everything, working some of it off itself along the way
+  auto owner_sum = 0LL;
+  auto elem = data_type { };
+  for (auto i = 1; i <= element_count; ++i)
+  {
+    while (! d.push(i))
+    {
+      if (d.pop(elem)) { owner_sum += elem; } // full: run a task inline
+    }
+  }
+
+  while (d.pop(elem)) { owner_sum += elem; }
+
+  done.store(true);
+  for (auto & thief : thieves) { thief.join(); }
+
+  // Every element was consumed by exactly one thread
+  auto total = owner_sum;
+  for (auto const sum : thief_sums) { total += sum; }
+
+  constexpr auto expected = static_cast<long long>(element_count)
+                          * (element_count + 1) / 2;
+  REQUIRE(total == expected);
+}
@@ -0,0 +1,175 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/dynamic_queue
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <lockfree/dynamic_queue.hpp>
+
+#include "../common.hpp"
+
+
+using namespace lockfree;
+
+
+using data_type = int;
+
+
+TEST_CASE("Dynamic queue rounds its capacity up to a power of two", "[dynamic_queue]")
+{
+  auto q = dynamic_queue<data_type> { 100 };
+  REQUIRE(q.capacity() == 128);
+  REQUIRE(q.empty());
+}
+
+
+TEST_CASE("Dynamic queue can push and pop elements", "[dynamic_queue]")
+{
+  auto q = dynamic_queue<data_type> { 16 };
+  auto res = data_type { };
+
+  REQUIRE(q.push(42));
+  REQUIRE(q.size() == 1);
+  REQUIRE(q.pop(res));
+  REQUIRE(res == 42);
+  REQUIRE(q.empty());
+}
+
+
+TEST_CASE("Dynamic queue rejects pushes when full", "[dynamic_queue]")
+{
+  auto q = dynamic_queue<data_type> { 4 };
+
+  for (auto i = 0; i < 4; ++i)
+  { REQUIRE(q.push(i)); }
+
+  REQUIRE(q.full());
+  REQUIRE_FALSE(q.push(4));
+
+  q.clear();
+  REQUIRE(q.empty());
+}
+
+
+TEST_CASE("Dynamic queue supports batch operations", "[dynamic_queue]")
+{
+  auto elems = std::array<data_type, 100> { };
+  auto out   = std::array<data_type, 100> { };
+  std::iota(std::begin(elems), std::end(elems), 0);
+
+  auto q = dynamic_queue<data_type> { 128 };
+
+  REQUIRE(q.push_range(std::begin(elems), std::end(elems)) == elems.size());
+  REQUIRE(q.pop_range(std::begin(out), std::end(out)) == out.size());
+  REQUIRE(out == elems);
+}
+
+
+TEST_CASE("Dynamic queue accepts huge-page backing requests", "[dynamic_queue]")
+{
+  // Whether the system actually provides huge pages or not, construction must
+  // succeed via the documented fallbacks.
+  auto q1 = dynamic_queue<data_type> { 1 << 16, page_backing::transparent_huge };
+  auto q2 = dynamic_queue<data_type> { 1 << 16, page_backing::huge };
+
+  REQUIRE(q1.push(1));
+  REQUIRE(q2.push(2));
+  REQUIRE(q1.pop().value_or(-1) == 1);
+  REQUIRE(q2.pop().value_or(-1) == 2);
+}
+
+
+namespace {
+
+// Tracks outstanding bytes so tests can verify ring placement went through the
+// user-supplied allocator (a stand-in for e.g. a NUMA-binding allocator)
+inline std::size_t counted_bytes = 0;
+
+template<typename T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  counting_allocator() noexcept = default;
+  template<typename U>
+  counting_allocator(counting_allocator<U> const&) noexcept { }
+
+  T * allocate(std::size_t n)
+  {
+    counted_bytes += n * sizeof(T);
+    return std::allocator<T> { }.allocate(n);
+  }
+
+  void deallocate(T * mem, std::size_t n) noexcept
+  {
+    counted_bytes -= n * sizeof(T);
+    std::allocator<T> { }.deallocate(mem, n);
+  }
+
+  template<typename U>
+  bool operator==(counting_allocator<U> const&) const noexcept { return true; }
+};
+
+} // namespace
+
+TEST_CASE("Dynamic queue places its ring through a user allocator", "[dynamic_queue]")
+{
+  using allocator = counting_allocator<std::byte>;
+
+  REQUIRE(counted_bytes == 0);
+
+  {
+    auto q = dynamic_queue<data_type, memory_model::acquire_release, allocator> {
+      100, allocator { } };
+
+    REQUIRE(q.capacity() == 128);
+    REQUIRE(counted_bytes >= q.capacity() * sizeof(data_type));
+
+    // First-touch placement binds the untouched ring to the calling thread's node
+    q.prefault();
+
+    REQUIRE(q.push(42));
+    REQUIRE(q.pop().value_or(-1) == 42);
+  }
+
+  REQUIRE(counted_bytes == 0); // the ring went back through the same allocator
+}
+
+
+TEST_CASE("Dynamic queue can be used safely in a multithreaded context",
+          "[dynamic_queue, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto data_size = 10'000;
+
+  auto input_buffer  = std::vector<data_type>(data_size);
+  auto output_buffer = std::vector<data_type>(data_size);
+  std::iota(std::begin(input_buffer), std::end(input_buffer), 0);
+
+  auto q = dynamic_queue<data_type> { 64 };
+
+  auto producer = std::thread([&q, &input_buffer] () {
+    for (auto elem : input_buffer)
+      q.push_wait( std::move(elem) );
+  });
+
+  auto consumer = std::thread([&q, &output_buffer] () {
+    for (auto & elem : output_buffer)
+      q.pop_wait(elem);
+  });
+
+  producer.join();
+  consumer.join();
+
+  REQUIRE(output_buffer == input_buffer);
+}
@@ -0,0 +1,138 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/mpmc_queue
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <lockfree/mpmc_queue.hpp>
+
+#include "../common.hpp"
+
+
+using namespace lockfree;
+
+
+using data_type = int;
+constexpr auto queue_size = std::size_t { 32 };
+
+
+/****************************************************************************************\
+  Single-threaded tests
+\****************************************************************************************/
+
+TEST_CASE("MPMC queue can be default constructed", "[mpmc_queue]")
+{
+  auto q = mpmc_queue<data_type, queue_size> { };
+  REQUIRE(q.empty());
+}
+
+
+TEST_CASE("MPMC queue can push and pop elements", "[mpmc_queue]")
+{
+  auto q = mpmc_queue<data_type, queue_size> { };
+  auto res = data_type { };
+
+  REQUIRE(q.push(42));
+  REQUIRE(q.pop(res));
+  REQUIRE(res == 42);
+}
+
+
+TEST_CASE("MPMC queue pops the same elements as pushed", "[mpmc_queue]")
+{
+  auto input_buffer = tests::helpers::iota<data_type, queue_size>();
+  auto output_buffer = std::array<data_type, queue_size>();
+  auto q = mpmc_queue<data_type, queue_size> { };
+
+  for (auto elem : input_buffer)
+  { REQUIRE(q.push(std::move(elem))); }
+
+  // The queue is now expected to be full
+  CHECK_FALSE(q.push(data_type { }));
+
+  for (auto & elem : output_buffer)
+  { REQUIRE(q.pop(elem)); }
+
+  // The queue is now expected to be empty
+  CHECK_FALSE(q.pop());
+
+  REQUIRE(output_buffer == input_buffer);
+}
+
+
+TEST_CASE("MPMC queue accepts a range of elements", "[mpmc_queue]")
+{
+  auto o_elems = std::vector<data_type> { 1, 2, 3, 4, 5 };
+  auto i_elems = std::vector<data_type>(o_elems.size());
+
+  auto q = mpmc_queue<data_type, queue_size> { };
+
+  auto i_count = q.push_range(std::begin(o_elems), std::end(o_elems));
+  auto o_count = q.pop_range(std::begin(i_elems),  std::end(i_elems));
+
+  REQUIRE(i_count == o_count);
+  REQUIRE(o_elems == i_elems);
+}
+
+
+/****************************************************************************************\
+  Multi-threaded tests
+\****************************************************************************************/
+
+TEST_CASE("Can be used safely with multiple producers and consumers", "[mpmc_queue, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto num_producers = 4;
+  constexpr auto num_consumers = 4;
+  constexpr auto per_producer  = 1000;
+
+  auto q = mpmc_queue<data_type, queue_size> { };
+  auto popped_sum   = std::atomic<long long> { 0 };
+  auto popped_count = std::atomic<int> { 0 };
+
+  auto producers = std::vector<std::thread> { };
+  auto consumers = std::vector<std::thread> { };
+
+  for (auto p = 0; p < num_producers; ++p)
+  {
+    producers.emplace_back([&q] () {
+      for (auto i = 1; i <= per_producer; ++i)
+      { while (! q.push(i)); }
+    });
+  }
+
+  for (auto c = 0; c < num_consumers; ++c)
+  {
+    consumers.emplace_back([&q, &popped_sum, &popped_count] () {
+      auto elem = data_type { };
+      while (popped_count.load() < num_producers * per_producer)
+      {
+        if (q.pop(elem))
+        {
+          popped_sum += elem;
+          ++popped_count;
+        }
+      }
+    });
+  }
+
+  for (auto & t : producers) t.join();
+  for (auto & t : consumers) t.join();
+
+  constexpr auto expected_sum =
+    static_cast<long long>(num_producers) * per_producer * (per_producer + 1) / 2;
+
+  REQUIRE(popped_count == num_producers * per_producer);
+  REQUIRE(popped_sum == expected_sum);
+}
@@ -0,0 +1,138 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/multicast_queue
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include <lockfree/multicast_queue.hpp>
+
+#include "../common.hpp"
+
+using lockfree::data_write_policy;
+
+using data_type = int;
+constexpr std::size_t queue_size = 8;
+
+
+TEST_CASE("Multicast queue delivers every element to every consumer", "[multicast_queue]")
+{
+  auto ring = lockfree::multicast_queue<data_type, queue_size> { };
+
+  auto first  = ring.add_consumer();
+  auto second = ring.add_consumer();
+
+  for (auto i = 1; i <= 5; ++i) { REQUIRE(ring.push(i)); }
+
+  // Both consumers see the same stream, in order, from the single copy in the ring
+  for (auto * consumer : { &first, &second })
+  {
+    auto elem = data_type { };
+    for (auto i = 1; i <= 5; ++i)
+    {
+      REQUIRE(consumer->poll(elem));
+      REQUIRE(elem == i);
+    }
+    REQUIRE(! consumer->poll(elem));
+  }
+}
+
+TEST_CASE("Multicast producer gates on the slowest consumer", "[multicast_queue]")
+{
+  auto ring = lockfree::multicast_queue<data_type, queue_size> { };
+
+  auto fast = ring.add_consumer();
+  auto slow = ring.add_consumer();
+
+  for (auto i = 0; i < static_cast<int>(queue_size); ++i) { REQUIRE(ring.push(i)); }
+
+  auto elem = data_type { };
+  while (fast.poll(elem)) { }
+
+  // The fast consumer has drained, but the slow one would be overwritten
+  REQUIRE(! ring.push(42));
+  REQUIRE(slow.lag() == queue_size);
+
+  REQUIRE(slow.poll(elem));
+  REQUIRE(ring.push(42));
+}
+
+TEST_CASE("Multicast consumers registered late start at the head", "[multicast_queue]")
+{
+  auto ring = lockfree::multicast_queue<data_type, queue_size> { };
+
+  // With no consumers registered, published elements are simply discarded
+  for (auto i = 0; i < 100; ++i) { REQUIRE(ring.push(i)); }
+
+  auto late = ring.add_consumer();
+  REQUIRE(late.lag() == 0);
+
+  auto elem = data_type { };
+  REQUIRE(! late.poll(elem));
+
+  REQUIRE(ring.push(1234));
+  REQUIRE(late.poll(elem));
+  REQUIRE(elem == 1234);
+}
+
+TEST_CASE("Multicast overwrite policy laps slow consumers", "[multicast_queue]")
+{
+  auto ring = lockfree::multicast_queue<data_type, queue_size, 8,
+                                        data_write_policy::overwrite> { };
+
+  auto consumer = ring.add_consumer();
+
+  // The producer free-runs; the consumer loses all but the most recent elements
+  for (auto i = 0; i < 100; ++i) { REQUIRE(ring.push(i)); }
+
+  auto elems = std::vector<data_type> { };
+  auto elem  = data_type { };
+  while (consumer.poll(elem)) { elems.push_back(elem); }
+
+  // A lapped consumer resynchronizes to the oldest element still intact
+  REQUIRE(elems.size() == queue_size - 1);
+  for (auto i = std::size_t { 0 }; i < elems.size(); ++i)
+  { REQUIRE(elems[i] == static_cast<int>(100 - elems.size() + i)); }
+}
+
+TEST_CASE("Multicast queue can be used safely in a multithreaded context", "[multicast_queue, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto element_count = 10000;
+  constexpr auto consumer_count = 3;
+
+  auto ring = lockfree::multicast_queue<data_type, queue_size, consumer_count> { };
+
+  auto sums = std::array<long long, consumer_count> { };
+  auto consumers = std::vector<std::thread> { };
+
+  for (auto c = 0; c < consumer_count; ++c)
+  {
+    auto handle = ring.add_consumer();
+    consumers.emplace_back([handle, &sum = sums[c]]() mutable {
+      auto elem = data_type { };
+      for (auto n = 0; n < element_count; ++n)
+      {
+        while (! handle.poll(elem)) { }
+        sum += elem;
+      }
+    });
+  }
+
+  for (auto i = 1; i <= element_count; ++i)
+  {
+    while (! ring.push(i)) { }
+  }
+
+  for (auto & consumer : consumers) { consumer.join(); }
+
+  // One write per element, yet every consumer saw the whole stream
+  constexpr auto expected = static_cast<long long>(element_count)
+                          * (element_count + 1) / 2;
+  for (auto const sum : sums) { REQUIRE(sum == expected); }
+}
@@ -0,0 +1,115 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/pool
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <cstddef>
+#include <thread>
+
+#include <lockfree/pool.hpp>
+#include <lockfree/queue.hpp>
+
+#include "../common.hpp"
+
+using lockfree::pool;
+
+constexpr std::size_t pool_size = 8;
+using data_type = int;
+
+
+TEST_CASE("Pool vends every element and reports exhaustion", "[pool]")
+{
+  auto p = pool<data_type, pool_size> { };
+  REQUIRE(p.available() == pool_size);
+
+  data_type * elems[pool_size];
+  for (auto & elem : elems)
+  {
+    elem = p.acquire();
+    REQUIRE(elem != nullptr);
+  }
+
+  REQUIRE(p.available() == 0);
+  REQUIRE(p.acquire() == nullptr);
+
+  for (auto elem : elems)
+  { p.release(elem); }
+
+  REQUIRE(p.available() == pool_size);
+}
+
+TEST_CASE("Pool elements have stable addresses across reuse", "[pool]")
+{
+  auto p = pool<data_type, pool_size> { };
+
+  auto first = p.acquire();
+  *first = 42;
+  p.release(first);
+
+  // Drain the free-list; the released element must come around again, unchanged
+  auto seen = false;
+  for (auto i = std::size_t { 0 }; i < pool_size; ++i)
+  {
+    auto elem = p.acquire();
+    seen = seen || (elem == first && *elem == 42);
+  }
+
+  REQUIRE(seen);
+}
+
+TEST_CASE("Pool handles release automatically", "[pool]")
+{
+  auto p = pool<data_type, pool_size> { };
+
+  {
+    auto h = p.acquire_scoped();
+    REQUIRE(h);
+    *h = 7;
+    REQUIRE(p.available() == pool_size - 1);
+
+    auto moved = std::move(h);
+    REQUIRE_FALSE(h);
+    REQUIRE(*moved == 7);
+  } // `moved` goes out of scope and returns the element
+
+  REQUIRE(p.available() == pool_size);
+}
+
+TEST_CASE("Pool provides an allocation-free return path", "[pool, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto data_size = 10000u;
+
+  auto p = pool<data_type, pool_size> { };
+  auto q = lockfree::queue<data_type *, pool_size> { };
+
+  // The producer acquires buffers and sends them; the consumer reads and releases
+  // them back — neither side allocates in steady state.
+  auto producer = std::thread { [&p, &q] {
+    for (auto i = 0u; i < data_size; ++i)
+    {
+      data_type * elem = nullptr;
+      while ((elem = p.acquire()) == nullptr) { }
+      *elem = static_cast<data_type>(i);
+      q.push_wait(elem);
+    }
+  } };
+
+  auto sum = std::uint64_t { 0 };
+  for (auto i = 0u; i < data_size; ++i)
+  {
+    data_type * elem = nullptr;
+    q.pop_wait(elem);
+    sum += static_cast<std::uint64_t>(*elem);
+    p.release(elem);
+  }
+
+  producer.join();
+
+  REQUIRE(sum == std::uint64_t { data_size } * (data_size - 1) / 2);
+  REQUIRE(p.available() == pool_size);
+}
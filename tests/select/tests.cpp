@@ -0,0 +1,143 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/select
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include <lockfree/queue.hpp>
+#include <lockfree/select.hpp>
+
+#include "../common.hpp"
+
+using data_type = int;
+constexpr std::size_t queue_size = 16;
+
+using queue_type = lockfree::queue<data_type, queue_size>;
+
+
+TEST_CASE("Select reports no queue ready when all are empty", "[select]")
+{
+  auto q0 = queue_type { };
+  auto q1 = queue_type { };
+
+  auto s = lockfree::select { q0, q1 };
+  REQUIRE(s.size() == 2);
+  REQUIRE(! s.poll().has_value());
+}
+
+TEST_CASE("Select finds the one non-empty queue", "[select]")
+{
+  auto q0 = queue_type { };
+  auto q1 = queue_type { };
+  auto q2 = queue_type { };
+
+  auto s = lockfree::select { q0, q1, q2 };
+
+  q1.push(42);
+
+  auto const ready = s.poll();
+  REQUIRE(ready.has_value());
+  REQUIRE(*ready == 1);
+
+  auto elem = data_type { };
+  REQUIRE(s[*ready].pop(elem));
+  REQUIRE(elem == 42);
+  REQUIRE(! s.poll().has_value());
+}
+
+TEST_CASE("Select services ready queues in rotation", "[select]")
+{
+  auto q0 = queue_type { };
+  auto q1 = queue_type { };
+  auto q2 = queue_type { };
+
+  auto s = lockfree::select { q0, q1, q2 };
+
+  q0.push(0);
+  q1.push(1);
+  q2.push(2);
+
+  // Each poll advances past the queue it just returned, so three polls visit all
+  // three queues even though none has been drained yet
+  auto visited = std::vector<std::size_t> { };
+  for (auto i = 0; i < 3; ++i)
+  {
+    auto const ready = s.poll();
+    REQUIRE(ready.has_value());
+    visited.push_back(*ready);
+
+    auto elem = data_type { };
+    REQUIRE(s[*ready].pop(elem));
+  }
+
+  REQUIRE(visited == std::vector<std::size_t> { 0, 1, 2 });
+  REQUIRE(! s.poll().has_value());
+}
+
+TEST_CASE("Select drops queues from the bitmap as they drain", "[select]")
+{
+  auto q0 = queue_type { };
+  auto q1 = queue_type { };
+
+  auto s = lockfree::select { q0, q1 };
+
+  q0.push(1);
+  q1.push(2);
+  q1.push(3);
+
+  // Drain q0 through the selector, then keep polling: only q1 remains ready
+  auto elem = data_type { };
+  REQUIRE(s[s.poll().value()].pop(elem));
+
+  for (auto i = 0; i < 2; ++i)
+  {
+    auto const ready = s.poll();
+    REQUIRE(ready.has_value());
+    REQUIRE(*ready == 1);
+    REQUIRE(s[*ready].pop(elem));
+  }
+
+  REQUIRE(! s.poll().has_value());
+}
+
+TEST_CASE("Select can fan in from producer threads", "[select, multi-threaded]")
+{
+  /* Note: passing this test is not a guarantee of thread-safety! */
+
+  constexpr auto count_per_queue = 1000;
+
+  auto q0 = queue_type { };
+  auto q1 = queue_type { };
+  auto q2 = queue_type { };
+
+  auto s = lockfree::select { q0, q1, q2 };
+
+  auto produce = [](queue_type & q) {
+    for (auto i = 1; i <= count_per_queue; ++i) { q.push_wait(i); }
+  };
+
+  auto producers = std::vector<std::thread> { };
+  producers.emplace_back(produce, std::ref(q0));
+  producers.emplace_back(produce, std::ref(q1));
+  producers.emplace_back(produce, std::ref(q2));
+
+  auto sum = 0;
+  for (auto n = 0; n < 3 * count_per_queue; ++n)
+  {
+    auto const ready = s.wait();
+
+    auto elem = data_type { };
+    REQUIRE(s[ready].pop(elem));
+    sum += elem;
+  }
+
+  for (auto & producer : producers) { producer.join(); }
+
+  REQUIRE(sum == 3 * (count_per_queue * (count_per_queue + 1) / 2));
+  REQUIRE(! s.poll().has_value());
+}
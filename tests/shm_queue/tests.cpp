@@ -0,0 +1,90 @@
+/****************************************************************************************\
+  File:    tests.cpp
+  Package: lockfree/tests/shm_queue
+  Created: 2026-08-30 by Tristan Bayfield
+
+  Copyright 2026, Tristan Bayfield.
+\****************************************************************************************/
+
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <lockfree/shm_queue.hpp>
+
+#include "../common.hpp"
+
+using lockfree::shm_queue;
+
+constexpr std::size_t queue_size = 32;
+using data_type = int;
+using queue_type = shm_queue<data_type, queue_size>;
+
+
+TEST_CASE("Shared-memory queue can be created in and attached to a region", "[shm_queue]")
+{
+  // Any suitably aligned storage works; shared mappings are only needed to actually
+  // cross a process boundary.
+  alignas(queue_type) static std::byte region[queue_type::region_size()];
+
+  auto q = queue_type::create(region);
+  REQUIRE(q->empty());
+
+  REQUIRE(q->push(42));
+
+  auto attached = queue_type::attach(region);
+  auto elem = data_type { };
+  REQUIRE(attached->pop(elem));
+  REQUIRE(elem == 42);
+  REQUIRE(attached->empty());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+TEST_CASE("Shared-memory queue crosses a process boundary", "[shm_queue, multi-process]")
+{
+  constexpr auto data_size = 1000;
+
+  auto region = ::mmap(nullptr, queue_type::region_size(), PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  REQUIRE(region != MAP_FAILED);
+
+  auto q = queue_type::create(region);
+
+  auto const pid = ::fork();
+  REQUIRE(pid >= 0);
+
+  if (pid == 0)
+  {
+    // Child: the producing process. _exit skips atexit handlers (and Catch2's).
+    auto producer_q = queue_type::attach(region);
+    for (auto i = 0; i < data_size; ++i)
+    {
+      while (! producer_q->push(i)) { }
+    }
+    ::_exit(0);
+  }
+
+  auto sum  = 0;
+  auto elem = data_type { };
+  for (auto i = 0; i < data_size; ++i)
+  {
+    while (! q->pop(elem)) { }
+    sum += elem;
+  }
+
+  auto status = 0;
+  REQUIRE(::waitpid(pid, &status, 0) == pid);
+  REQUIRE(WIFEXITED(status));
+  REQUIRE(WEXITSTATUS(status) == 0);
+
+  REQUIRE(sum == data_size * (data_size - 1) / 2);
+
+  ::munmap(region, queue_type::region_size());
+}
+
+#endif // __unix__ || __APPLE__